@@ -0,0 +1,163 @@
+#include <nth/cobs.h>
+#include <cstdio>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#if (NTH_COBS_X86_SIMD)
+#define NTH_COBS_BENCH_RDTSC 1
+#else
+#define NTH_COBS_BENCH_RDTSC 0
+#endif
+
+namespace nth::bench {
+
+/**
+ * @brief Payload profile for benchmark input generation.
+ *
+ */
+enum class profile_t {
+    zero_free,  ///< No zero bytes at all, longest possible blocks.
+    all_zero,   ///< Only zero bytes, one code byte per payload byte.
+    random,     ///< Uniform random bytes, ~1/256 zero density.
+    boundary,   ///< Zero right after each full 254-byte block, adversarial for the block walk.
+};
+
+static const char* profile_name(profile_t p)
+{
+    switch (p) {
+        case profile_t::zero_free: return "zero-free";
+        case profile_t::all_zero:  return "all-zero";
+        case profile_t::random:    return "random";
+        case profile_t::boundary:  return "boundary";
+    }
+    return "?";
+}
+
+static std::vector<uint8_t> make_payload(profile_t p, size_t n)
+{
+    std::vector<uint8_t> out(n);
+    std::mt19937 rng(42);
+    for (size_t i = 0; i < n; ++i) {
+        switch (p) {
+            case profile_t::zero_free: out[i] = uint8_t(1 + i % 255); break;
+            case profile_t::all_zero:  out[i] = 0; break;
+            case profile_t::random:    out[i] = uint8_t(rng()); break;
+            case profile_t::boundary:  out[i] = (i % 255 == 254) ? 0 : uint8_t(1 + i % 255); break;
+        }
+    }
+    return out;
+}
+
+static uint64_t cycles()
+{
+#if (NTH_COBS_BENCH_RDTSC)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Time `fn()` until ~100 ms elapsed and report throughput.
+ *
+ * @param name Code path name.
+ * @param bytes Input bytes processed per `fn()` call.
+ * @param fn Callable running one pass over the payload.
+ */
+static void report(const char* name, size_t bytes, auto&& fn)
+{
+    using clock = std::chrono::steady_clock;
+
+    fn(); // Warm-up, also faults in the buffers
+
+    size_t iters = 0;
+    auto t0 = clock::now();
+    auto c0 = cycles();
+    auto spent = clock::duration::zero();
+
+    do {
+        fn();
+        ++iters;
+        spent = clock::now() - t0;
+    } while (spent < std::chrono::milliseconds(100));
+
+    auto c1 = cycles();
+    double sec = std::chrono::duration<double>(spent).count();
+    double total = double(bytes) * double(iters);
+    double gbps = total / sec * 1e-9;
+#if (NTH_COBS_BENCH_RDTSC)
+    double bpc = c1 > c0 ? total / double(c1 - c0) : 0.0;
+    printf("  %-24s %8.3f GB/s %8.3f bytes/cycle\n", name, gbps, bpc);
+#else
+    printf("  %-24s %8.3f GB/s\n", name, gbps);
+#endif
+}
+
+static void run(profile_t p, size_t n)
+{
+    auto payload = make_payload(p, n);
+    std::vector<uint8_t> encoded(cobs_encode_max_size(n) + 1);
+    std::vector<uint8_t> decoded(n + 1);
+    size_t encoded_size = cobs_encode(payload, encoded);
+    encoded[encoded_size++] = 0;
+    std::span<const uint8_t> enc = { encoded.data(), encoded_size };
+
+    printf("%s, %zu bytes\n", profile_name(p), n);
+
+    size_t sink_size = 0; // Keeps the callbacks from being optimized out
+    auto enc_cb = [&] (const uint8_t*, size_t size) {
+        sink_size += size;
+    };
+    auto dec_cb = [&] (const uint8_t*, size_t size, size_t) {
+        sink_size += size;
+    };
+    cobs_encoder_t encoder;
+    cobs_decoder_t decoder;
+
+    report("encoder_t::sink/stop", n, [&] {
+        encoder.sink(payload, enc_cb);
+        encoder.stop(enc_cb);
+    });
+    report("cobs_encode(in, cb)", n, [&] {
+        sink_size += cobs_encode(payload, enc_cb);
+    });
+    report("cobs_encode(in, out)", n, [&] {
+        sink_size += cobs_encode(payload, encoded);
+    });
+    report("decoder_t::sink", encoded_size, [&] {
+        decoder.sink(enc, dec_cb);
+    });
+    report("cobs_decode(in, cb)", encoded_size, [&] {
+        sink_size += cobs_decode(enc, dec_cb);
+    });
+    report("cobs_decode(in, out)", encoded_size, [&] {
+        sink_size += cobs_decode(enc, decoded);
+    });
+    if (sink_size == 42)
+        printf("\n"); // Never taken, defeats dead code elimination
+}
+
+}
+
+int main()
+{
+    using namespace nth::bench;
+
+    constexpr profile_t profiles[] = {
+        profile_t::zero_free,
+        profile_t::all_zero,
+        profile_t::random,
+        profile_t::boundary,
+    };
+    constexpr size_t sizes[] = {
+        64,
+        4096,
+        65536,
+        1 << 20,
+    };
+    for (auto p : profiles) {
+        for (auto n : sizes)
+            run(p, n);
+    }
+}
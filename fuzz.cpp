@@ -0,0 +1,691 @@
+#include <nth/cobs.h>
+#include <nth/cobs_parallel.h>
+#include <nth/cobs_async.h>
+#include <nth/cobs_pipe.h>
+#include <nth/cobs_pool.h>
+#include <nth/cobs_index.h>
+#if defined(__unix__) || defined(__APPLE__)
+#define NTH_COBS_FUZZ_FILE 1
+#include <nth/cobs_file.h>
+#else
+#define NTH_COBS_FUZZ_FILE 0
+#endif
+#include <cstdio>
+#include <random>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <array>
+
+#if (NTH_COBS_X86_SIMD)
+#define NTH_COBS_FUZZ_RDTSC 1
+#else
+#define NTH_COBS_FUZZ_RDTSC 0
+#endif
+
+namespace nth::fuzz {
+
+static uint64_t cycles()
+{
+#if (NTH_COBS_FUZZ_RDTSC)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Per-path cycle and byte accumulator for the end-of-run table.
+ *
+ */
+struct path_t {
+    const char* name;
+    uint64_t spent = 0;
+    uint64_t bytes = 0;
+
+    auto measure(size_t n, auto&& fn)
+    {
+        auto c0 = cycles();
+        auto r = fn();
+        spent += cycles() - c0;
+        bytes += n;
+        return r;
+    }
+};
+
+static size_t fails = 0;
+
+static void check(bool ok, const char* path, size_t case_id)
+{
+    if (!ok) {
+        printf("MISMATCH: %s, case %zu\n", path, case_id);
+        ++fails;
+    }
+}
+
+/**
+ * @brief Adversarial payload corpus: zero-run sweeps, block-boundary
+ * straddles around every multiple of 254, and biased random inputs.
+ *
+ */
+static std::vector<std::vector<uint8_t>> make_corpus()
+{
+    std::vector<std::vector<uint8_t>> corpus;
+    // Zero-run sweep: nonzero runs of every width up to two blocks, zero-separated
+    for (size_t run = 0; run <= 510; ++run) {
+        std::vector<uint8_t> p;
+        for (size_t rep = 0; rep < 2; ++rep) {
+            for (size_t i = 0; i < run; ++i)
+                p.push_back(uint8_t(1 + i % 255));
+            p.push_back(0);
+        }
+        corpus.push_back(std::move(p));
+    }
+    // Block-boundary straddles: a single zero swept across both 254-boundaries
+    for (size_t n : { size_t(253), size_t(254), size_t(255), size_t(507), size_t(508), size_t(509) }) {
+        for (size_t at = 0; at <= n; ++at) {
+            std::vector<uint8_t> p(n, 0x41);
+            if (at < n)
+                p[at] = 0;
+            corpus.push_back(std::move(p));
+        }
+    }
+    // Biased random: zero densities from zero-free to all-zero
+    std::mt19937 rng(27);
+    for (size_t i = 0; i < 400; ++i) {
+        size_t n = rng() % 1200;
+        size_t den = 1 + rng() % 256;
+        std::vector<uint8_t> p(n);
+        for (auto& b : p)
+            b = (rng() % den) ? uint8_t(rng() | 1) : 0;
+        corpus.push_back(std::move(p));
+    }
+    return corpus;
+}
+
+static path_t enc_span       = { "cobs_encode(in, out)" };
+static path_t enc_cb         = { "cobs_encode(in, cb)" };
+static path_t enc_iter       = { "cobs_encode(in, iter)" };
+static path_t enc_iov        = { "cobs_encode(iov, out)" };
+static path_t enc_sink       = { "encoder_t::sink/stop" };
+static path_t enc_alloc      = { "cobs_encode_alloc" };
+static path_t enc_reduced    = { "cobs_r_encode" };
+static path_t dec_span       = { "cobs_decode(in, out)" };
+static path_t dec_cb         = { "cobs_decode(in, cb)" };
+static path_t dec_iter       = { "cobs_decode(in, iter)" };
+static path_t dec_unchecked  = { "validate + unchecked" };
+static path_t dec_sink       = { "decoder_t::sink" };
+static path_t dec_frame      = { "frame_decoder_t::sink" };
+static path_t dec_view       = { "decoder_view_t::sink" };
+static path_t dec_reduced    = { "cobs_r_decode" };
+
+/**
+ * @brief Round-trip one payload through every encode and decode path.
+ *
+ * The span overloads are the reference; every other path must agree
+ * byte-for-byte, including cross-pairing the streaming encoder with the
+ * one-shot decoders and vice versa.
+ */
+static void run_case(std::span<const uint8_t> payload, size_t case_id, std::mt19937& rng)
+{
+    size_t n = payload.size();
+    std::vector<uint8_t> ref(cobs_encode_max_size(n));
+    size_t ref_size = enc_span.measure(n, [&] {
+        return cobs_encode(payload, std::span<uint8_t>{ref});
+    });
+    ref.resize(ref_size);
+
+    // Encode paths against the span reference
+    std::vector<uint8_t> out;
+    out.reserve(ref_size);
+    size_t size = enc_cb.measure(n, [&] {
+        return cobs_encode(payload, [&] (const uint8_t* p, size_t len) {
+            out.insert(out.end(), p, p + len);
+        });
+    });
+    check(size == ref_size && out == ref, enc_cb.name, case_id);
+
+    out.assign(ref_size, 0xaa);
+    size = enc_iter.measure(n, [&] {
+        return cobs_encode(payload, out.data());
+    });
+    check(size == ref_size && out == ref, enc_iter.name, case_id);
+
+    std::span<const uint8_t> frags[3] = {
+        payload.first(n / 3),
+        payload.subspan(n / 3, n / 2 - n / 3),
+        payload.subspan(n / 2),
+    };
+    out.assign(ref_size, 0xaa);
+    size = enc_iov.measure(n, [&] {
+        return cobs_encode(std::span<const std::span<const uint8_t>>{frags}, std::span<uint8_t>{out});
+    });
+    check(size == ref_size && out == ref, enc_iov.name, case_id);
+
+    out.clear();
+    enc_sink.measure(n, [&] {
+        cobs_encoder_t encoder;
+        auto cb = [&] (const uint8_t* p, size_t len) {
+            out.insert(out.end(), p, p + len);
+        };
+        for (size_t off = 0; off < n;) {
+            size_t chunk = 1 + rng() % 300;
+            if (chunk > n - off)
+                chunk = n - off;
+            encoder.sink(payload.subspan(off, chunk), cb);
+            off += chunk;
+        }
+        encoder.stop(cb);
+        return 0;
+    });
+    check(out.size() == ref_size + 1 && !out.back() &&
+          std::equal(ref.begin(), ref.end(), out.begin()), enc_sink.name, case_id);
+
+    auto owned = enc_alloc.measure(n, [&] {
+        return cobs_encode_alloc(payload);
+    });
+    check(owned.size() == ref_size + 1 && !owned.data()[ref_size] &&
+          std::equal(ref.begin(), ref.end(), owned.data()), enc_alloc.name, case_id);
+
+    // Decode paths against the payload, with and without the delimiter
+    std::vector<uint8_t> enc = ref;
+    if (rng() % 2)
+        enc.push_back(0);
+    std::span<const uint8_t> in = { enc.data(), enc.size() };
+    std::vector<uint8_t> dec(n + 1);
+
+    size = dec_span.measure(enc.size(), [&] {
+        return cobs_decode(in, std::span<uint8_t>{dec});
+    });
+    check(size == n && std::equal(payload.begin(), payload.end(), dec.begin()), dec_span.name, case_id);
+
+    out.clear();
+    size = dec_cb.measure(enc.size(), [&] {
+        return cobs_decode(in, [&] (const uint8_t* p, size_t len, size_t left) {
+            if (!left)
+                out.insert(out.end(), p, p + len);
+        });
+    });
+    check(size == n && std::equal(payload.begin(), payload.end(), out.begin()), dec_cb.name, case_id);
+
+    dec.assign(n + 1, 0xaa);
+    size = dec_iter.measure(enc.size(), [&] {
+        return cobs_decode(in, dec.data());
+    });
+    check(size == n && std::equal(payload.begin(), payload.end(), dec.begin()), dec_iter.name, case_id);
+
+    dec.assign(n + 1, 0xaa);
+    size = dec_unchecked.measure(enc.size(), [&] {
+        return cobs_validate(in) == n ? cobs_decode_unchecked(in, dec.data()) : size_t(-1);
+    });
+    check(size == n && std::equal(payload.begin(), payload.end(), dec.begin()), dec_unchecked.name, case_id);
+
+    out.clear();
+    size_t left_sum = 0;
+    dec_sink.measure(enc.size(), [&] {
+        cobs_decoder_t decoder;
+        auto cb = [&] (const uint8_t* p, size_t len, size_t left) {
+            out.insert(out.end(), p, p + len);
+            left_sum += left;
+        };
+        for (size_t off = 0; off < enc.size();) {
+            size_t chunk = 1 + rng() % 300;
+            if (chunk > enc.size() - off)
+                chunk = enc.size() - off;
+            decoder.sink(in.subspan(off, chunk), cb);
+            off += chunk;
+        }
+        if (enc.size() == ref_size)
+            decoder.stop(cb); // No in-stream delimiter fed
+        return 0;
+    });
+    check(!left_sum && out.size() == n &&
+          std::equal(payload.begin(), payload.end(), out.begin()), dec_sink.name, case_id);
+
+    out.clear();
+    left_sum = 0;
+    dec_frame.measure(enc.size(), [&] {
+        cobs_frame_decoder_t<2048> decoder;
+        auto cb = [&] (const uint8_t* p, size_t len, size_t left) {
+            out.insert(out.end(), p, p + len);
+            left_sum += left;
+        };
+        decoder.sink(in, cb);
+        if (enc.size() == ref_size)
+            decoder.stop(cb);
+        return 0;
+    });
+    check(!left_sum && out.size() == n &&
+          std::equal(payload.begin(), payload.end(), out.begin()), dec_frame.name, case_id);
+
+    out.clear();
+    left_sum = 0;
+    dec_view.measure(enc.size(), [&] {
+        cobs_decoder_view_t decoder;
+        auto cb = [&] (const uint8_t* p, size_t len, size_t left) {
+            out.insert(out.end(), p, p + len);
+            left_sum += left;
+        };
+        decoder.sink(in, cb);
+        if (enc.size() == ref_size)
+            decoder.stop(cb);
+        return 0;
+    });
+    check(!left_sum && out.size() == n &&
+          std::equal(payload.begin(), payload.end(), out.begin()), dec_view.name, case_id);
+
+    // COBS/R round trip, and the reduced decoder on the classic frame
+    std::vector<uint8_t> renc(cobs_encode_max_size(n));
+    size_t renc_size = enc_reduced.measure(n, [&] {
+        return cobs_r_encode(payload, std::span<uint8_t>{renc});
+    });
+    dec.assign(n + 1, 0xaa);
+    size = dec_reduced.measure(renc_size, [&] {
+        return cobs_r_decode({renc.data(), renc_size}, std::span<uint8_t>{dec});
+    });
+    check(renc_size <= ref_size && size == n &&
+          std::equal(payload.begin(), payload.end(), dec.begin()), dec_reduced.name, case_id);
+    dec.assign(n + 1, 0xaa);
+    check(cobs_r_decode(in, std::span<uint8_t>{dec}) == n &&
+          std::equal(payload.begin(), payload.end(), dec.begin()), "cobs_r_decode(classic)", case_id);
+
+    // Truncations at every offset: the checked decode paths must agree
+    for (size_t cut = 0; cut < ref_size; ++cut) {
+        auto part = std::span<const uint8_t>{ref.data(), cut};
+        size_t a = cobs_validate(part);
+        size_t b = cobs_decode(part, std::span<uint8_t>{dec});
+        size_t c = cobs_decode(part, [] (const uint8_t*, size_t, size_t) {});
+        size_t d = cobs_decode_unchecked(part, dec.data());
+        check(a == b && b == c && c == d, "truncation agreement", case_id);
+    }
+}
+
+/**
+ * @brief Deterministic payload for the subsystem round-trips below.
+ *
+ * @param tag Stream identity, so independent tests get independent data.
+ * @param idx Payload index within the stream.
+ */
+static std::vector<uint8_t> sub_payload(size_t tag, size_t idx)
+{
+    std::minstd_rand rng(unsigned(tag * 48271 + idx + 1));
+    std::vector<uint8_t> p(rng() % 300);
+    for (auto& b : p)
+        b = uint8_t(rng());
+    return p;
+}
+
+/**
+ * @brief Append one payload to a stream as an encoded delimited frame.
+ *
+ */
+static void sub_append(std::vector<uint8_t>& stream, std::span<const uint8_t> payload)
+{
+    size_t off = stream.size();
+    stream.resize(off + cobs_encode_max_size(payload.size()));
+    stream.resize(off + cobs_encode(payload, std::span<uint8_t>{stream}.subspan(off)));
+    stream.push_back(0x00);
+}
+
+/**
+ * @brief The parallel batch codecs must match their serial references
+ * byte-for-byte, offsets, sizes and malformed-frame reporting included.
+ */
+static void run_parallel()
+{
+    std::vector<std::vector<uint8_t>> owned;
+    for (size_t i = 0; i < 500; ++i)
+        owned.push_back(sub_payload(1, i));
+    std::vector<std::span<const uint8_t>> frames{owned.begin(), owned.end()};
+
+    size_t need = cobs_encode_batch(frames, {});
+    std::vector<uint8_t> a(need, 0xaa);
+    std::vector<uint8_t> b(need, 0x55);
+    std::vector<size_t> offa(frames.size());
+    std::vector<size_t> offb(frames.size());
+    check(cobs_encode_batch(frames, a, offa) == need, "cobs_encode_batch(reference)", 0);
+    check(cobs_encode_parallel(frames, b, 4, offb) == need && a == b && offa == offb,
+          "cobs_encode_parallel", 0);
+
+    auto sized = cobs_decode_batch(a, {});
+    std::vector<uint8_t> da(sized.size, 0xaa);
+    std::vector<uint8_t> db(sized.size, 0x55);
+    std::vector<size_t> doffa(sized.frames);
+    std::vector<size_t> doffb(sized.frames);
+    auto ra = cobs_decode_batch(a, da, doffa);
+    auto rb = cobs_decode_parallel(a, db, 4, doffb);
+    check(ra.size == rb.size && ra.frames == rb.frames && da == db && doffa == doffb,
+          "cobs_decode_parallel", 0);
+
+    // A malformed frame mid-stream must be reported with the same index
+    std::vector<uint8_t> bad(a.begin(), a.begin() + ptrdiff_t(offa[10]));
+    bad.insert(bad.end(), { 0x05, 0x31, 0x00 });
+    bad.insert(bad.end(), a.begin() + ptrdiff_t(offa[10]), a.end());
+    ra = cobs_decode_batch(bad, da);
+    rb = cobs_decode_parallel(bad, db, 4);
+    check(!ra.size && ra.frames == 10 && rb.size == ra.size && rb.frames == ra.frames,
+          "cobs_decode_parallel(malformed)", 0);
+}
+
+/**
+ * @brief SPSC pipe round trip: a producer thread encodes frames into the
+ * ring while a consumer thread drains them through the streaming decoder.
+ */
+static void run_pipe()
+{
+    static cobs_pipe_t<4096> pipe;
+    constexpr size_t count = 2000;
+    std::vector<uint8_t> expect;
+    for (size_t i = 0; i < count; ++i) {
+        auto p = sub_payload(2, i);
+        expect.insert(expect.end(), p.begin(), p.end());
+    }
+    std::vector<uint8_t> got;
+    got.reserve(expect.size());
+    size_t left_sum = 0;
+    std::thread producer{[&] {
+        for (size_t i = 0; i < count; ++i) {
+            auto p = sub_payload(2, i);
+            while (!pipe.send(p))
+                std::this_thread::yield();
+        }
+    }};
+    while (got.size() < expect.size()) {
+        if (!pipe.recv([&] (const uint8_t* p, size_t len, size_t left) {
+                got.insert(got.end(), p, p + len);
+                left_sum += left;
+            }))
+            std::this_thread::yield();
+    }
+    producer.join();
+    check(!left_sum && got == expect, "cobs_pipe_t round trip", 0);
+}
+
+/**
+ * @brief Consumer coroutine collecting a fixed number of frames.
+ *
+ */
+static cobs_task_t sub_consume(cobs_decode_stream_t<512>& s, size_t count,
+                               std::vector<std::vector<uint8_t>>& got)
+{
+    for (size_t i = 0; i < count; ++i) {
+        auto f = co_await s.next();
+        got.emplace_back(f.begin(), f.end());
+    }
+}
+
+/**
+ * @brief Coroutine decode stream round trip over ragged fragments, plus
+ * the drop paths: an oversized or malformed frame must be skipped
+ * without touching a pending undelivered frame.
+ */
+static void run_async()
+{
+    std::minstd_rand rng(5);
+    std::vector<std::vector<uint8_t>> want;
+    std::vector<uint8_t> stream;
+    for (size_t i = 0; i < 200; ++i) {
+        want.push_back(sub_payload(3, i));
+        sub_append(stream, want.back());
+    }
+    std::vector<std::vector<uint8_t>> got;
+    cobs_decode_stream_t<512> rx;
+    sub_consume(rx, want.size(), got);
+    for (size_t off = 0; off < stream.size();) {
+        size_t chunk = 1 + rng() % 97;
+        if (chunk > stream.size() - off)
+            chunk = stream.size() - off;
+        rx.feed({stream.data() + off, chunk});
+        off += chunk;
+    }
+    check(!rx.dropped() && got == want, "cobs_decode_stream_t round trip", 0);
+
+    // Drops with a frame pending: deliver {1,2,3} with no consumer
+    // awaiting, then an oversized and a malformed frame; the consumer
+    // must still receive the pending frame intact
+    cobs_decode_stream_t<512> rx2;
+    std::vector<uint8_t> drops;
+    sub_append(drops, std::array<uint8_t, 3>{ 1, 2, 3 });
+    sub_append(drops, std::vector<uint8_t>(600, 0x42));
+    drops.insert(drops.end(), { 0x05, 0x31, 0x00 });
+    rx2.feed(drops);
+    std::vector<std::vector<uint8_t>> got2;
+    sub_consume(rx2, 2, got2);
+    uint8_t more[] = { 0x03, 0x41, 0x42, 0x00 };
+    rx2.feed(more);
+    check(rx2.dropped() == 2 && got2.size() == 2 &&
+          got2[0] == std::vector<uint8_t>{ 1, 2, 3 } &&
+          got2[1] == std::vector<uint8_t>{ 0x41, 0x42 }, "cobs_decode_stream_t(drops)", 0);
+}
+
+#if (NTH_COBS_FUZZ_FILE)
+
+static bool sub_write_file(const char* path, std::span<const uint8_t> bytes)
+{
+    FILE* f = fopen(path, "wb");
+    if (!f)
+        return false;
+    bool ok = !bytes.size() || fwrite(bytes.data(), 1, bytes.size(), f) == bytes.size();
+    return !fclose(f) && ok;
+}
+
+static std::vector<uint8_t> sub_read_file(const char* path)
+{
+    std::vector<uint8_t> bytes;
+    FILE* f = fopen(path, "rb");
+    if (!f)
+        return bytes;
+    uint8_t chunk[4096];
+    for (size_t n; (n = fread(chunk, 1, sizeof(chunk), f));)
+        bytes.insert(bytes.end(), chunk, chunk + n);
+    fclose(f);
+    return bytes;
+}
+
+/**
+ * @brief Memory-mapped file drivers against in-memory references, plus
+ * the malformed-capture, empty-file and missing-file error paths.
+ */
+static void run_file()
+{
+    const char* cap = "/tmp/cobs_fuzz_capture.bin";
+    const char* unp = "/tmp/cobs_fuzz_unpacked.bin";
+    const char* pay = "/tmp/cobs_fuzz_payload.bin";
+    const char* frm = "/tmp/cobs_fuzz_frame.bin";
+
+    std::vector<std::vector<uint8_t>> want;
+    std::vector<uint8_t> archive;
+    std::vector<uint8_t> flat;
+    for (size_t i = 0; i < 300; ++i) {
+        want.push_back(sub_payload(4, i));
+        flat.insert(flat.end(), want.back().begin(), want.back().end());
+        sub_append(archive, want.back());
+    }
+    check(sub_write_file(cap, archive), "cobs_decode_file(setup)", 0);
+
+    size_t idx = 0;
+    size_t mismatches = 0;
+    auto res = cobs_decode_file(cap, [&] (const uint8_t* p, size_t len) {
+        if (idx >= want.size() || want[idx] != std::vector<uint8_t>(p, p + len))
+            ++mismatches;
+        ++idx;
+    });
+    check(res.size == flat.size() && res.frames == want.size() &&
+          idx == want.size() && !mismatches, "cobs_decode_file(cb)", 0);
+
+    std::vector<size_t> offsets(want.size());
+    res = cobs_decode_file(cap, unp, offsets);
+    size_t pos = 0;
+    size_t off_bad = 0;
+    for (size_t i = 0; i < want.size(); ++i) {
+        off_bad += offsets[i] != pos;
+        pos += want[i].size();
+    }
+    check(res.size == flat.size() && res.frames == want.size() &&
+          !off_bad && sub_read_file(unp) == flat, "cobs_decode_file(out)", 0);
+
+    check(sub_write_file(pay, flat), "cobs_encode_file(setup)", 0);
+    std::vector<uint8_t> ref(cobs_encode_max_size(flat.size()) + 1);
+    size_t ref_size = cobs_encode(flat, std::span<uint8_t>{ref});
+    ref[ref_size++] = 0x00;
+    ref.resize(ref_size);
+    check(cobs_encode_file(pay, frm) == ref_size && sub_read_file(frm) == ref,
+          "cobs_encode_file", 0);
+
+    // A malformed frame reports its index, an empty capture decodes to
+    // nothing and a missing file reports a file error
+    std::vector<uint8_t> bad;
+    for (size_t i = 0; i < 3; ++i)
+        sub_append(bad, want[i]);
+    bad.insert(bad.end(), { 0x05, 0x31, 0x00 });
+    sub_append(bad, want[3]);
+    check(sub_write_file(cap, bad), "cobs_decode_file(setup)", 1);
+    res = cobs_decode_file(cap, [] (const uint8_t*, size_t) {});
+    check(!res.size && res.frames == 3, "cobs_decode_file(malformed)", 0);
+    check(sub_write_file(cap, {}), "cobs_decode_file(setup)", 2);
+    res = cobs_decode_file(cap, [] (const uint8_t*, size_t) {});
+    check(!res.size && !res.frames, "cobs_decode_file(empty)", 0);
+    res = cobs_decode_file("/tmp/cobs_fuzz_nonexistent.bin", [] (const uint8_t*, size_t) {});
+    check(!res.size && res.frames == size_t(-1), "cobs_decode_file(missing)", 0);
+
+    remove(cap);
+    remove(unp);
+    remove(pay);
+    remove(frm);
+}
+
+#endif
+
+/**
+ * @brief Work-stealing pool round trip: producers submit frames on their
+ * own connections while a dedicated thread hammers `flush()`, and the
+ * completion callback checks per-connection order and content.
+ */
+static void run_pool()
+{
+    constexpr size_t n_producers = 4;
+    constexpr size_t n_frames = 2000; // Per producer, on 2 connections each
+    std::array<std::atomic<size_t>, n_producers * 2> next = {};
+    std::atomic<size_t> errors = 0;
+    std::atomic<size_t> done = 0;
+    auto on_done = [&] (size_t conn, const uint8_t* p, size_t size, size_t left) {
+        size_t idx = next[conn].fetch_add(1, std::memory_order_relaxed);
+        auto want = sub_payload(100 + conn, idx);
+        if (left || size != want.size() || !std::equal(p, p + size, want.begin()))
+            errors.fetch_add(1, std::memory_order_relaxed);
+        done.fetch_add(1, std::memory_order_relaxed);
+    };
+    {
+        cobs_codec_pool_t pool{on_done, 4};
+        std::atomic<bool> stop = false;
+        std::thread flusher{[&] {
+            while (!stop.load(std::memory_order_relaxed))
+                pool.flush(); // Must never block with submissions in flight
+        }};
+        std::vector<std::thread> producers;
+        for (size_t p = 0; p < n_producers; ++p) {
+            producers.emplace_back([&, p] {
+                std::vector<uint8_t> enc;
+                for (size_t i = 0; i < n_frames; ++i) {
+                    size_t conn = p * 2 + i % 2;
+                    auto pay = sub_payload(100 + conn, i / 2);
+                    enc.assign(cobs_encode_max_size(pay.size()) + 1, 0);
+                    size_t n = cobs_encode(pay, std::span<uint8_t>{enc});
+                    enc[n++] = 0x00;
+                    pool.submit(conn, {enc.data(), n});
+                }
+            });
+        }
+        for (auto& t : producers)
+            t.join();
+        pool.flush();
+        stop = true;
+        flusher.join();
+    }
+    check(!errors && done == n_producers * n_frames, "cobs_codec_pool_t round trip", 0);
+
+    // A malformed frame must complete with left != 0
+    std::atomic<size_t> bad = 0;
+    auto on_bad = [&] (size_t, const uint8_t*, size_t, size_t left) {
+        bad += left ? 1 : 0;
+    };
+    {
+        cobs_codec_pool_t pool{on_bad, 2};
+        uint8_t mal[] = { 0x05, 0x31, 0x00 };
+        pool.submit(0, mal);
+        pool.flush();
+    }
+    check(bad == 1, "cobs_codec_pool_t(malformed)", 0);
+}
+
+/**
+ * @brief Sidecar index over a multi-group archive: random O(1) lookups
+ * must decode the exact frames, and the error paths must hold.
+ */
+static void run_index()
+{
+    std::minstd_rand rng(9);
+    cobs_index_writer_t writer;
+    std::vector<std::vector<uint8_t>> want;
+    std::vector<uint8_t> archive;
+    for (size_t i = 0; i < 3000; ++i) { // Spans multiple base groups
+        want.push_back(sub_payload(5, i));
+        writer.add(archive.size());
+        sub_append(archive, want.back());
+    }
+    std::vector<uint8_t> sidecar(writer.size());
+    check(writer.write(sidecar) == sidecar.size(), "cobs_index_writer_t::write", 0);
+
+    cobs_index_view_t view{sidecar};
+    check(view.valid() && view.frames() == want.size(), "cobs_index_view_t(valid)", 0);
+    std::vector<uint8_t> dec;
+    size_t mismatches = 0;
+    for (size_t i = 0; i < 500; ++i) {
+        size_t k = rng() % want.size();
+        dec.assign(want[k].size() + 1, 0xaa);
+        mismatches += view.decode(archive, k, dec) != want[k].size() ||
+                      !std::equal(want[k].begin(), want[k].end(), dec.begin());
+    }
+    check(!mismatches, "cobs_index_view_t::decode", 0);
+
+    // An undersized buffer reports the required size without writing,
+    // and a corrupt magic invalidates the view
+    check(writer.write({sidecar.data(), sidecar.size() - 1}) == sidecar.size(),
+          "cobs_index_writer_t(undersized)", 0);
+    sidecar[0] ^= 0xff;
+    check(!cobs_index_view_t{sidecar}.valid(), "cobs_index_view_t(corrupt)", 0);
+}
+
+}
+
+int main()
+{
+    using namespace nth::fuzz;
+
+    auto corpus = make_corpus();
+    std::mt19937 rng(1);
+    for (size_t i = 0; i < corpus.size(); ++i)
+        run_case({corpus[i].data(), corpus[i].size()}, i, rng);
+
+    run_parallel();
+    run_pipe();
+    run_async();
+#if (NTH_COBS_FUZZ_FILE)
+    run_file();
+#endif
+    run_pool();
+    run_index();
+
+    printf("%zu cases + subsystem round trips, %zu failures\n", corpus.size(), fails);
+    path_t* paths[] = {
+        &enc_span, &enc_cb, &enc_iter, &enc_iov, &enc_sink, &enc_alloc, &enc_reduced,
+        &dec_span, &dec_cb, &dec_iter, &dec_unchecked, &dec_sink, &dec_frame, &dec_view, &dec_reduced,
+    };
+#if (NTH_COBS_FUZZ_RDTSC)
+    for (auto* p : paths)
+        printf("  %-24s %8.3f cycles/byte\n", p->name, p->bytes ? double(p->spent) / double(p->bytes) : 0.0);
+#else
+    (void)paths;
+#endif
+    return fails ? 1 : 0;
+}
@@ -24,14 +24,297 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <array>
+#include <cstring>
 #include <type_traits>
 #include <functional>
 #include <concepts>
+#include <iterator>
 #include <utility>
+#include <memory>
 #include <span>
+#include <bit>
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NTH_COBS_X86_SIMD   1
+#include <immintrin.h>
+#else
+#define NTH_COBS_X86_SIMD   0
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define NTH_COBS_NEON       1
+#include <arm_neon.h>
+#else
+#define NTH_COBS_NEON       0
+#endif
 
 namespace nth {
 
+/**
+ * @brief Workload hint for the one-shot encode span overload.
+ *
+ * Selects which runtime kernel `cobs_encode(in, out)` compiles to.
+ * All hints produce identical, fully interoperable output; they only
+ * trade scan granularity against branch cost for a known zero density.
+ */
+enum class cobs_hint {
+    balanced,       ///< Default: per-block vectorized zero scan.
+    sparse_zeros,   ///< Zero bytes are rare: scan whole zero-free runs ahead, then bulk-copy.
+    dense_zeros,    ///< Zero bytes dominate: plain byte loop, no scan setup overhead.
+};
+
+namespace impl {
+
+/**
+ * @brief Find offset of the first `0x00` byte in a memory range.
+ *
+ * Runtime helper for the non-constexpr fast paths. Scans 32/16 bytes at
+ * a time when SIMD is available, then 8 bytes at a time with a SWAR
+ * `uint64_t` zero test on little-endian targets, and finishes with a
+ * byte loop.
+ *
+ * @param p Pointer to bytes to scan.
+ * @param n Number of bytes to scan.
+ * @return Offset of the first zero byte, or `n` if none found.
+ */
+inline size_t cobs_scan_zero(const uint8_t* p, size_t n) noexcept
+{
+    const uint8_t* q = p;
+#if (NTH_COBS_X86_SIMD)
+#if defined(__AVX2__)
+    while (n >= 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(q));
+        uint32_t m = _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_setzero_si256()));
+        if (m)
+            return q - p + std::countr_zero(m);
+        q += 32;
+        n -= 32;
+    }
+#endif
+    while (n >= 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(q));
+        uint32_t m = _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128()));
+        if (m)
+            return q - p + std::countr_zero(m);
+        q += 16;
+        n -= 16;
+    }
+#elif (NTH_COBS_NEON)
+    while (n >= 16) {
+        uint8x16_t v = vld1q_u8(q);
+        uint8x16_t e = vceqq_u8(v, vdupq_n_u8(0));
+        uint64_t m = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(e), 4)), 0);
+        if (m)
+            return q - p + (std::countr_zero(m) >> 2);
+        q += 16;
+        n -= 16;
+    }
+#endif
+    if constexpr (std::endian::native == std::endian::little) {
+        while (n >= 8) {
+            uint64_t v;
+            std::memcpy(&v, q, 8);
+            uint64_t m = (v - 0x0101010101010101ull) & ~v & 0x8080808080808080ull;
+            if (m) // Lowest set flag is exact, first in memory on little-endian
+                return q - p + (std::countr_zero(m) >> 3);
+            q += 8;
+            n -= 8;
+        }
+    }
+    while (n--) {
+        if (!*q)
+            return q - p;
+        ++q;
+    }
+    return q - p;
+}
+
+/**
+ * @brief Runtime fast path of `cobs_encode(in, out)`.
+ *
+ * Walks the input block-wise: scans for the next zero byte with
+ * `cobs_scan_zero` and bulk-copies each block instead of testing
+ * and storing byte by byte. Output semantics match the constexpr
+ * loop exactly: writes only as many bytes as fit, returns required.
+ *
+ * @param in Input bytes to encode.
+ * @param out Output buffer.
+ * @return Required number of encoded bytes.
+ */
+inline size_t cobs_encode_fast(std::span<const uint8_t> in, std::span<uint8_t> out) noexcept
+{
+    const uint8_t* src = in.data();
+    const uint8_t* end = in.data() + in.size();
+    uint8_t* dst = out.data();
+    uint8_t* dst_end = out.data() + out.size();
+    size_t required = 0;
+
+    while (true) {
+        size_t lim = size_t(end - src);
+        if (lim > 254)
+            lim = 254;
+        size_t run = cobs_scan_zero(src, lim);
+        required += 1 + run;
+        if (dst < dst_end) {
+            *dst++ = uint8_t(run + 1);
+            size_t fit = size_t(dst_end - dst);
+            if (fit > run)
+                fit = run;
+            if (fit) {
+                std::memcpy(dst, src, fit);
+                dst += fit;
+            }
+        }
+        src += run;
+        if (run < lim) { // Stopped at an actual zero byte
+            ++src;
+            if (src == end) { // Trailing zero encodes as a final empty block
+                ++required;
+                if (dst < dst_end)
+                    *dst = 1;
+                break;
+            }
+            continue;
+        }
+        if (run == 254 && src < end)
+            continue; // Full block with more input to follow
+        break;
+    }
+    return required;
+}
+
+/**
+ * @brief Runtime kernel of `cobs_encode(in, out)` for `cobs_hint::sparse_zeros`.
+ *
+ * Scans ahead for the next zero byte across the whole remaining input
+ * in one pass, then emits the run as full 254-byte blocks with bulk
+ * copies and no further zero tests. Output is identical to the other
+ * kernels; only the scan granularity differs.
+ *
+ * @param in Input bytes to encode.
+ * @param out Output buffer.
+ * @return Required number of encoded bytes.
+ */
+inline size_t cobs_encode_sparse(std::span<const uint8_t> in, std::span<uint8_t> out) noexcept
+{
+    const uint8_t* src = in.data();
+    const uint8_t* end = in.data() + in.size();
+    uint8_t* dst = out.data();
+    uint8_t* dst_end = out.data() + out.size();
+    size_t required = 0;
+
+    auto emit = [&] (uint8_t code, const uint8_t* p, size_t len) {
+        required += 1 + len;
+        if (dst < dst_end) {
+            *dst++ = code;
+            size_t fit = size_t(dst_end - dst);
+            if (fit > len)
+                fit = len;
+            if (fit) {
+                std::memcpy(dst, p, fit);
+                dst += fit;
+            }
+        }
+    };
+    while (true) {
+        size_t rem = size_t(end - src);
+        size_t run = cobs_scan_zero(src, rem);
+        bool zero = run < rem;
+        while (run >= 254) {
+            bool last = run == 254 && !zero; // Block ends exactly at end of input
+            emit(0xff, src, 254);
+            src += 254;
+            run -= 254;
+            if (last)
+                return required;
+        }
+        emit(uint8_t(run + 1), src, run);
+        src += run;
+        if (!zero)
+            return required;
+        ++src;
+        if (src == end) { // Trailing zero encodes as a final empty block
+            ++required;
+            if (dst < dst_end)
+                *dst = 1;
+            return required;
+        }
+    }
+}
+
+/**
+ * @brief Find offset of the first `0x00` byte, usable in constant evaluation.
+ *
+ * Dispatches to `cobs_scan_zero` at runtime and to a byte loop in
+ * constant-evaluated contexts.
+ *
+ * @param p Pointer to bytes to scan.
+ * @param n Number of bytes to scan.
+ * @return Offset of the first zero byte, or `n` if none found.
+ */
+constexpr size_t cobs_find_zero(const uint8_t* p, size_t n) noexcept
+{
+    if (!std::is_constant_evaluated())
+        return cobs_scan_zero(p, n);
+    for (size_t i = 0; i < n; ++i) {
+        if (!p[i])
+            return i;
+    }
+    return n;
+}
+
+/**
+ * @brief Runtime fast path of `cobs_decode(in, out)`.
+ *
+ * Once a code byte is read, the next `code - 1` bytes are copyable
+ * verbatim, so each block is consumed with a single bulk copy instead
+ * of per-byte stores. Output semantics match the constexpr loop:
+ * writes only as many bytes as fit, returns required, 0 if malformed.
+ *
+ * @param in Input to decode, trailing `0x00` is optional.
+ * @param out Output buffer.
+ * @return Required number of decoded bytes or 0 if the input is malformed.
+ */
+inline size_t cobs_decode_fast(std::span<const uint8_t> in, std::span<uint8_t> out) noexcept
+{
+    const uint8_t* src = in.data();
+    const uint8_t* end = in.data() + in.size();
+    uint8_t* dst = out.data();
+    uint8_t* dst_end = out.data() + out.size();
+    uint8_t code = 0xff;
+    size_t required = 0;
+
+    while (src < end) {
+        uint8_t c = *src++;
+        if (!c)
+            break; // Delimiter terminates the frame
+        if (code != 0xff) {
+            if (dst < dst_end)
+                *dst++ = 0;
+            ++required;
+        }
+        code = c;
+        size_t want = size_t(c) - 1;
+        size_t avail = size_t(end - src);
+        size_t take = want < avail ? want : avail;
+        size_t fit = size_t(dst_end - dst);
+        if (fit > take)
+            fit = take;
+        if (fit) {
+            std::memcpy(dst, src, fit);
+            dst += fit;
+        }
+        required += take;
+        src += take;
+        if (take < want)
+            return 0u; // Block truncated by end of input
+    }
+    return required;
+}
+
+}
+
 /**
  * @brief Concept for a callable that writes encoded COBS output.
  * 
@@ -42,60 +325,187 @@ namespace nth {
 template<class W>
 concept CobsEncodeCb = std::is_invocable_r_v<void, W&, const uint8_t*, size_t>;
 
+/**
+ * @brief Empty placeholder for a disabled statistics facet.
+ *
+ * Occupies no storage as a `[[no_unique_address]]` member.
+ */
+struct cobs_stats_none_t {};
+
+/**
+ * @brief Statistics counters of `cobs_encoder_t` with the stats facet on.
+ *
+ */
+struct cobs_encoder_stats_t {
+    size_t bytes_in = 0;    ///< Payload bytes sunk.
+    size_t bytes_out = 0;   ///< Encoded bytes handed to callbacks, delimiters included.
+    size_t frames = 0;      ///< Frames finalized via `stop()`.
+    size_t flushes = 0;     ///< Block flushes, one per zero byte or full block.
+    size_t max_fill = 0;    ///< Highest data fill of a block at flush or stop time.
+};
+
 /**
  * @brief Streaming COBS encoder with internal buffering.
  *
- * Designed for scenarios where data arrives in fragments and needs to 
+ * Designed for scenarios where data arrives in fragments and needs to
  * be encoded on-the-fly without preallocating large output buffers.
  *
+ * The block size trades maximum block length (and thus coding overhead)
+ * against per-instance memory and flush latency. A full block of `N` data
+ * bytes uses code `N + 1` as its continuation marker, so both ends of a
+ * link must agree on `N`; the default of 254 is standard COBS.
+ *
+ * With `Stats` enabled the instance keeps `cobs_encoder_stats_t`
+ * counters, readable via `stats()`, e.g. to tell pathological inputs
+ * (many tiny flushes) from a slow consumer; disabled, the facet costs
+ * no storage and no instructions.
+ *
+ * With `Reduced` enabled, `stop()` emits COBS/R: the final data byte is
+ * folded into the last code byte when unambiguous, saving one byte per
+ * frame; pair with a `Reduced` decoder or `cobs_r_decode`.
+ *
  * @note Final chunk includes `0x00` delimiter.
+ *
+ * @tparam N Maximum data bytes per block, 1..254, default 254.
+ * @tparam Stats Enable the per-instance statistics facet.
+ * @tparam Reduced Emit COBS/R framing on `stop()`.
  */
+template<size_t N = 254, bool Stats = false, bool Reduced = false>
 struct cobs_encoder_t {
 
+    static_assert(N >= 1 && N <= 254, "COBS block size must be 1..254");
+
     /**
-     * @brief Reset internal state.
-     * 
+     * @brief Reset internal state, statistics included.
+     *
      */
     constexpr void reset()
     {
         buf[0] = 0;
+        stat = {};
+    }
+
+    /**
+     * @brief Read the statistics counters.
+     *
+     */
+    constexpr const cobs_encoder_stats_t& stats() const requires (Stats)
+    {
+        return stat;
     }
 
     /**
      * @brief Sink incoming data using a generic callable.
-     * 
+     *
+     * Processes the span block-wise: scans for the next zero or block
+     * boundary with the vectorized zero search and bulk-copies whole
+     * runs into the buffer, branching once per block instead of once
+     * per byte. Flush boundaries and chunks match the per-byte `step()`
+     * exactly, including the deferred flush of a full final block.
+     *
      * @param in Input data.
      * @param cb Callable to handle encoded chunk when ready.
      */
     constexpr void sink(std::span<const uint8_t> in, CobsEncodeCb auto&& cb)
     {
+        if constexpr (Stats)
+            stat.bytes_in += in.size();
         auto& wr = cb;
-        for (auto b : in) step(b, wr);
+        const uint8_t* src = in.data();
+        size_t left = in.size();
+
+        while (left) {
+            if (buf[0] == N)
+                flush(wr); // Deferred full-block flush, only now that more input exists
+            size_t room = N - buf[0];
+            size_t lim = left < room ? left : room;
+            size_t run = impl::cobs_find_zero(src, lim);
+            if (run) {
+                if (std::is_constant_evaluated()) {
+                    for (size_t i = 0; i < run; ++i)
+                        buf[1 + buf[0] + i] = src[i];
+                } else {
+                    std::memcpy(buf + 1 + buf[0], src, run);
+                }
+                buf[0] += run;
+                src += run;
+                left -= run;
+            }
+            if (run < lim) { // Stopped at an actual zero byte
+                flush(wr);
+                ++src;
+                --left;
+            }
+        }
+    }
+
+    /**
+     * @brief Emit the buffered partial block without terminating the frame.
+     *
+     * Bounds link latency for trickle-rate input that would otherwise
+     * sit buffered until a zero byte or a full block: the pending bytes
+     * go out immediately with a correct code byte and the frame stays
+     * open for more `sink()` data. COBS cannot mark an early block
+     * boundary transparently, so a flushed partial block implies one
+     * `0x00` in the decoded payload at the flush point — a natural
+     * record separator for sample streams, costing 1 byte instead of
+     * the 2-byte overhead and frame termination of `stop()` per flush.
+     * A full pending block flushes without the implied zero, and an
+     * empty buffer emits nothing.
+     *
+     * @param cb Callable to handle encoded chunk when ready.
+     */
+    constexpr void flush_partial(CobsEncodeCb auto&& cb)
+    {
+        if (buf[0])
+            flush(cb);
     }
 
     /**
      * @brief Finalize encoding and write output using a generic callable.
-     * 
+     *
      * @param cb Callable to handle encoded chunk when ready.
      */
     NTH_COBS_NOINLINE_ATTR constexpr void stop(CobsEncodeCb auto&& cb)
     {
+        uint8_t fill = buf[0];
+        if constexpr (Reduced) {
+            if (fill && buf[fill] >= fill + 1u) { // Last byte can stand in for the final code
+                if constexpr (Stats) {
+                    ++stat.frames;
+                    stat.bytes_out += fill + 1u;
+                    if (fill > stat.max_fill)
+                        stat.max_fill = fill;
+                }
+                buf[0] = buf[fill]; // Folded code takes the counter slot
+                buf[fill] = 0;      // Delimiter overwrites the folded byte
+                std::invoke(cb, buf, fill + 1u);
+                buf[0] = 0;
+                return;
+            }
+        }
+        if constexpr (Stats) {
+            ++stat.frames;
+            stat.bytes_out += fill + 2u;
+            if (fill > stat.max_fill)
+                stat.max_fill = fill;
+        }
         buf[1 + buf[0]++] = 0;
         std::invoke(cb, buf, buf[0] + 1);
-        reset();
+        buf[0] = 0;
     }
 
 protected:
 
     /**
      * @brief Encode single byte using a generic callable.
-     * 
+     *
      * @param b Input byte.
      * @param cb Callable to handle encoded chunk when ready.
      */
     NTH_COBS_NOINLINE_ATTR constexpr void step(uint8_t b, CobsEncodeCb auto& cb)
     {
-        if (buf[0] == 0xfe)
+        if (buf[0] == N)
             flush(cb);
         if (!b)
             flush(cb);
@@ -105,18 +515,95 @@ protected:
 
     /**
      * @brief Flush ready chunk to the callable.
-     * 
+     *
      * @param cb Callable to handle encoded chunk when ready.
      */
     NTH_COBS_NOINLINE_ATTR constexpr void flush(CobsEncodeCb auto& cb)
     {
+        if constexpr (Stats) {
+            ++stat.flushes;
+            stat.bytes_out += buf[0] + 1u;
+            if (buf[0] > stat.max_fill)
+                stat.max_fill = buf[0];
+        }
         std::invoke(cb, buf, ++buf[0]);
-        reset();
+        buf[0] = 0;
     }
 
-    uint8_t buf[256] = {};
+    uint8_t buf[N + 2] = {};
+    [[no_unique_address]] std::conditional_t<Stats, cobs_encoder_stats_t, cobs_stats_none_t> stat = {};
 };
 
+/**
+ * @brief Worst-case encoded size for a payload of `n` bytes.
+ *
+ * One code byte plus one extra per started 254-byte block, reached by
+ * zero-free payloads.
+ *
+ * @note Does NOT include the final `0x00` delimiter.
+ *
+ * @param n Payload size in bytes.
+ * @return Maximum possible encoded size.
+ */
+constexpr size_t cobs_encode_max_size(size_t n) noexcept
+{
+    return n ? n + 1 + (n - 1) / 254 : 1;
+}
+
+/**
+ * @brief Worst-case decoded size for an encoded frame of `n` bytes.
+ *
+ * At least one code byte is consumed, so the payload can never exceed
+ * `n - 1` bytes.
+ *
+ * @param n Encoded frame size in bytes, without the `0x00` delimiter.
+ * @return Maximum possible decoded size.
+ */
+constexpr size_t cobs_decode_max_size(size_t n) noexcept
+{
+    return n ? n - 1 : 0;
+}
+
+/**
+ * @brief Exact encoded size of a payload in a single pass.
+ *
+ * Pure scan with no output writes, vectorized zero search at runtime.
+ * Lets an allocator place the encoded frame with zero slack instead of
+ * over-allocating `cobs_encode_max_size` per frame.
+ *
+ * @note Does NOT include the final `0x00` delimiter.
+ *
+ * @param in Input bytes that would be encoded.
+ * @return Exact number of encoded bytes, equals `cobs_encode(in, out)`.
+ */
+NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_encode_size(std::span<const uint8_t> in) noexcept
+{
+    const uint8_t* src = in.data();
+    const uint8_t* end = in.data() + in.size();
+    size_t required = 0;
+
+    while (true) {
+        size_t rem = size_t(end - src);
+        size_t run = impl::cobs_find_zero(src, rem);
+        bool zero = run < rem;
+        while (run >= 254) {
+            bool last = run == 254 && !zero; // Block ends exactly at end of input
+            required += 255;
+            src += 254;
+            run -= 254;
+            if (last)
+                return required;
+        }
+        required += run + 1;
+        src += run;
+        if (!zero)
+            return required;
+        ++src;
+        if (src == end) // Trailing zero encodes as a final empty block
+            return required + 1;
+    }
+}
+
 /**
  * @brief Encode with COBS using output callable.
  *
@@ -170,12 +657,20 @@ NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_encode(std::span<const uint8_t> in,
  * 
  * @note Does NOT write the final `0x00` delimiter.
  *
+ * @tparam H Optional workload hint selecting the runtime kernel, see `cobs_hint`.
  * @param in Input bytes to encode.
  * @param out Output buffer.
  * @return Required number of encoded bytes.
  */
+template<cobs_hint H = cobs_hint::balanced>
 NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_encode(std::span<const uint8_t> in, std::span<uint8_t> out) noexcept
 {
+    if (!std::is_constant_evaluated() && H != cobs_hint::dense_zeros) {
+        if constexpr (H == cobs_hint::sparse_zeros)
+            return impl::cobs_encode_sparse(in, out);
+        else
+            return impl::cobs_encode_fast(in, out);
+    }
     const uint8_t* src = in.data();
     const uint8_t* end = in.data() + in.size();
     uint8_t* dst_len = out.data();
@@ -210,94 +705,996 @@ NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_encode(std::span<const uint8_t> in,
 }
 
 /**
- * @brief Concept for a callable that writes decoded COBS output.
- * 
- * @tparam W Callable to write decoded chunk when ready.
- * @param data Pointer to decoded bytes.
- * @param size Number of decoded bytes.
- * @param left Number of bytes left to receive if delimiter came prematurely.
+ * @brief Encode with COBS through an output iterator.
+ *
+ * No callable sits in the loop: each block's code is known from the
+ * zero scan before its bytes are written, so the whole encode of a
+ * small frame compiles down to straight-line code. The iterator is
+ * never backpatched, making single-pass sinks like `back_inserter`
+ * usable; the caller guarantees capacity for `cobs_encode_max_size()`
+ * bytes.
+ *
+ * @note Does NOT write the final `0x00` delimiter.
+ *
+ * @param in Input bytes to encode.
+ * @param out Output iterator receiving encoded bytes.
+ * @return Number of encoded bytes written.
+ */
+template<std::output_iterator<uint8_t> O>
+NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_encode(std::span<const uint8_t> in, O out)
+{
+    const uint8_t* src = in.data();
+    const uint8_t* end = in.data() + in.size();
+    size_t written = 0;
+
+    while (true) {
+        size_t lim = size_t(end - src);
+        if (lim > 254)
+            lim = 254;
+        size_t run = impl::cobs_find_zero(src, lim);
+        *out++ = uint8_t(run + 1);
+        for (size_t i = 0; i < run; ++i)
+            *out++ = src[i];
+        written += 1 + run;
+        src += run;
+        if (run < lim) { // Stopped at an actual zero byte
+            ++src;
+            if (src == end) { // Trailing zero encodes as a final empty block
+                *out++ = 1;
+                ++written;
+                break;
+            }
+            continue;
+        }
+        if (run == 254 && src < end)
+            continue; // Full block with more input to follow
+        break;
+    }
+    return written;
+}
+
+/**
+ * @brief Concept of a payload tap callable for the fused codec overloads.
+ *
+ * Invoked with consecutive payload chunks as the codec walks them, so a
+ * checksum, length accounting or keystream application runs over bytes
+ * that are already hot in cache instead of in a second full traversal.
+ * The chunks concatenate to exactly the payload, in order.
  */
 template<class W>
-concept CobsDecodeCb = std::is_invocable_r_v<void, W&, const uint8_t*, size_t, size_t>;
+concept CobsTapCb = std::is_invocable_r_v<void, W&, const uint8_t*, size_t>;
 
 /**
- * @brief Streaming COBS decoder with internal buffering.
- * 
- * Designed for scenarios where data arrives in fragments and needs to be decoded 
- * on-the-fly without preallocating large output buffers. You may either feed the 
- * terminator `0x00` via `sink()` as part of the input stream, or omit it and call 
- * `stop(cb)` at the end of a frame. On termination, the callback receives one final 
- * chunk with number of missing payload bytes in the last block: `left == 0` for a 
- * well-formed frame, `left > 0` for a malformed or truncated frame. After termination, 
- * the decoder resets and is ready for the next frame.
- * 
+ * @brief Encode with COBS into a buffer, tapping the payload in one pass.
+ *
+ * Behaves like `cobs_encode(in, out)`, but additionally hands each
+ * payload chunk to `tap` as it is scanned, fusing e.g. the frame CRC
+ * into the single encode traversal. Truncated-output semantics match
+ * the plain buffer overload.
+ *
+ * @note Does NOT write the final `0x00` delimiter.
+ *
+ * @param in Input bytes to encode.
+ * @param out Output buffer.
+ * @param tap Callable observing consecutive payload chunks.
+ * @return Required number of encoded bytes.
  */
-struct cobs_decoder_t {
+NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_encode(std::span<const uint8_t> in, std::span<uint8_t> out, CobsTapCb auto&& tap)
+{
+    const uint8_t* src = in.data();
+    const uint8_t* end = in.data() + in.size();
+    uint8_t* dst = out.data();
+    uint8_t* dst_end = out.data() + out.size();
+    size_t required = 0;
 
-    /**
-     * @brief Reset internal state.
-     * 
-     */
-    constexpr void reset()
-    {
-        size = 0;
-        code = 0;
+    while (true) {
+        size_t lim = size_t(end - src);
+        if (lim > 254)
+            lim = 254;
+        size_t run = impl::cobs_find_zero(src, lim);
+        bool zero = run < lim;
+        if (dst < dst_end)
+            *dst++ = uint8_t(run + 1);
+        size_t room = size_t(dst_end - dst);
+        size_t fit = run < room ? run : room;
+        if (std::is_constant_evaluated()) {
+            for (size_t i = 0; i < fit; ++i)
+                dst[i] = src[i];
+        } else {
+            std::memcpy(dst, src, fit);
+        }
+        dst += fit;
+        required += 1 + run;
+        if (run + zero)
+            std::invoke(tap, src, run + zero); // Payload chunk, terminating zero included
+        src += run + zero;
+        if (zero) {
+            if (src == end) { // Trailing zero encodes as a final empty block
+                if (dst < dst_end)
+                    *dst = 1;
+                return required + 1;
+            }
+            continue;
+        }
+        if (run == 254 && src < end)
+            continue; // Full block with more input to follow
+        return required;
     }
+}
 
-    /**
-     * @brief Sink incoming data using a generic callable.
-     * 
-     * @param in Input data.
+/**
+ * @brief Encode into a buffer in cache-sized tiles for fused pipelines.
+ *
+ * Encode-then-process pipelines that run `cobs_encode(in, out)` over a
+ * large batch and only then hand `out` downstream stream the working
+ * set through the cache twice. This driver encodes like the buffer
+ * overload but invokes `cb` with each just-encoded output tile while
+ * it is still cache-resident. Tile boundaries are rounded up to the
+ * next block boundary, so every tile is independently decodable up to
+ * its trailing implied zero; the tiles concatenate to exactly the
+ * encoded frame. Truncated-output semantics match the plain buffer
+ * overload, with `cb` invoked only for fully written tiles.
+ *
+ * @note Does NOT write the final `0x00` delimiter.
+ *
+ * @param in Input bytes to encode.
+ * @param out Output buffer.
+ * @param tile_size Tile granularity in input bytes, 0 for one single tile.
+ * @param cb Callable receiving each encoded tile while cache-hot.
+ * @return Required number of encoded bytes.
+ */
+NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_encode_tiled(std::span<const uint8_t> in, std::span<uint8_t> out, size_t tile_size, CobsEncodeCb auto&& cb)
+{
+    const uint8_t* src = in.data();
+    const uint8_t* end = in.data() + in.size();
+    uint8_t* dst = out.data();
+    uint8_t* dst_end = out.data() + out.size();
+    uint8_t* tile = out.data();
+    const uint8_t* tile_src = src;
+    size_t required = 0;
+
+    if (!tile_size)
+        tile_size = size_t(-1);
+
+    while (true) {
+        size_t lim = size_t(end - src);
+        if (lim > 254)
+            lim = 254;
+        size_t run = impl::cobs_find_zero(src, lim);
+        bool zero = run < lim;
+        if (dst < dst_end)
+            *dst++ = uint8_t(run + 1);
+        size_t room = size_t(dst_end - dst);
+        size_t fit = run < room ? run : room;
+        if (std::is_constant_evaluated()) {
+            for (size_t i = 0; i < fit; ++i)
+                dst[i] = src[i];
+        } else {
+            std::memcpy(dst, src, fit);
+        }
+        dst += fit;
+        required += 1 + run;
+        src += run + zero;
+        if (zero && src == end) { // Trailing zero encodes as a final empty block
+            if (dst < dst_end)
+                *dst++ = 1;
+            ++required;
+            break;
+        }
+        if (!zero && (run < 254 || src == end))
+            break;
+        // Block boundary: close the tile once enough input was consumed
+        if (size_t(src - tile_src) >= tile_size && required == size_t(dst - out.data())) {
+            std::invoke(cb, tile, size_t(dst - tile));
+            tile = dst;
+            tile_src = src;
+        }
+    }
+    if (dst > tile && required == size_t(dst - out.data()))
+        std::invoke(cb, tile, size_t(dst - tile));
+    return required;
+}
+
+/**
+ * @brief Encode a fragment list with COBS using output callable.
+ *
+ * Treats the fragments as one logical byte stream, carrying the block
+ * state across fragment boundaries, so headers, payload and trailers
+ * living in separate buffers encode without a staging copy. Blocks
+ * contained in a single fragment are forwarded zero-copy; only the tail
+ * of a block that straddles fragments goes through a small carry buffer.
+ *
+ * @note Does NOT write the final `0x00` delimiter.
+ *
+ * @param iov List of input fragments forming one frame.
+ * @param cb Callable to handle encoded chunk when ready.
+ * @return Total number of encoded bytes.
+ */
+NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_encode(std::span<const std::span<const uint8_t>> iov, CobsEncodeCb auto&& cb)
+{
+    if (iov.size() == 1)
+        return cobs_encode(iov[0], cb);
+
+    uint8_t carry[254] = {};
+    uint8_t carry_len = 0;
+    size_t total = 0;
+
+    const uint8_t* chunk = nullptr;
+    const uint8_t* src = nullptr;
+
+    auto write_block = [&] (size_t chunk_size) {
+        uint8_t code = uint8_t(carry_len + chunk_size + 1);
+        std::invoke(cb, &code, 1);
+        if (carry_len)
+            std::invoke(cb, carry, carry_len);
+        std::invoke(cb, chunk, chunk_size);
+        total += 1u + carry_len + chunk_size;
+        carry_len = 0;
+    };
+    for (auto frag : iov) {
+        chunk = frag.data();
+        src = frag.data();
+        const uint8_t* end = frag.data() + frag.size();
+        for (; src < end; ++src) {
+            if (carry_len + size_t(src - chunk) == 254) {
+                write_block(src - chunk); // Flush full block (254 bytes of data)
+                chunk = src;
+            }
+            if (!*src) {
+                write_block(src - chunk); // Flush current block (may be empty if just flushed above)
+                chunk = src + 1;
+            }
+        }
+        for (const uint8_t* p = chunk; p < end; ++p) // Stash the straddling partial block
+            carry[carry_len++] = *p;
+        chunk = end;
+    }
+    write_block(0);
+    return total;
+}
+
+/**
+ * @brief Encode a fragment list with COBS directly into output buffer.
+ *
+ * Buffer counterpart of the fragment-list callback overload: output is
+ * byte-for-byte identical to encoding the concatenation of all
+ * fragments. If output buffer is too small, the function still returns
+ * the total required size, but writes only as many bytes as fit.
+ *
+ * @note Does NOT write the final `0x00` delimiter.
+ *
+ * @param iov List of input fragments forming one frame.
+ * @param out Output buffer.
+ * @return Required number of encoded bytes.
+ */
+NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_encode(std::span<const std::span<const uint8_t>> iov, std::span<uint8_t> out) noexcept
+{
+    if (iov.size() == 1)
+        return cobs_encode(iov[0], out);
+
+    uint8_t* dst_len = out.data();
+    uint8_t* dst_dat = out.data() + 1;
+    uint8_t* dst_end = out.data() + out.size();
+    uint8_t code = 1;
+    size_t required = 1;
+    size_t remaining = 0;
+
+    for (auto frag : iov)
+        remaining += frag.size();
+
+    for (auto frag : iov) {
+        for (auto b : frag) {
+            --remaining;
+            if (b) {
+                if (dst_dat < dst_end)
+                    *dst_dat++ = b;
+                ++code;
+                ++required;
+            }
+            if (code == 0xff || !b) {
+                if (dst_len < dst_end)
+                    dst_len[0] = code;
+                dst_len = dst_dat;
+                code = 1;
+                if (!b || remaining) {
+                    if (dst_dat < dst_end)
+                        dst_dat++;
+                    ++required;
+                }
+            }
+        }
+    }
+    if (dst_len < dst_end)
+        dst_len[0] = code;
+    return required;
+}
+
+/**
+ * @brief Encode with COBS/R (reduced) directly into output buffer.
+ *
+ * COBS/R folds the final data byte into the last code byte whenever
+ * that byte is large enough to be unambiguous, shaving one byte off
+ * most frames — significant airtime at small telemetry record sizes.
+ * Implemented as a classic `cobs_encode` followed by a patch of the
+ * final block, so all fast kernels are reused. Truncated-output
+ * semantics match the classic overload: returns required size, writes
+ * only what fits.
+ *
+ * @note Does NOT write the final `0x00` delimiter.
+ * @note Decode with `cobs_r_decode` only; classic decoders misread folded frames.
+ *
+ * @param in Input bytes to encode.
+ * @param out Output buffer.
+ * @return Required number of encoded bytes.
+ */
+NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_r_encode(std::span<const uint8_t> in, std::span<uint8_t> out) noexcept
+{
+    size_t required = cobs_encode(in, out);
+    if (in.empty() || !in.back())
+        return required; // Final block is empty, nothing to fold
+
+    size_t tail = 0; // Zero-free tail run, its last <= 254 bytes form the final block
+    while (tail < in.size() && in[in.size() - 1 - tail])
+        ++tail;
+    size_t fill = tail % 254;
+    if (!fill)
+        fill = 254;
+    if (in.back() >= fill + 1) { // Last byte can stand in for the final code
+        size_t pos = required - 1 - fill;
+        if (pos < out.size())
+            out[pos] = in.back();
+        --required;
+    }
+    return required;
+}
+
+/**
+ * @brief Encode a constant frame at compile time into a right-sized array.
+ *
+ * Runs the same verified encode logic in constant evaluation, so fixed
+ * protocol frames (handshakes, keepalives, error beacons) become
+ * `.rodata` blobs with zero runtime cost and zero RAM. The array is
+ * sized exactly with `cobs_encode_size()`.
+ *
+ * @note Unlike the runtime overloads, the trailing `0x00` delimiter IS
+ * included: the returned blob is ready to transmit as-is.
+ *
+ * @tparam Frame Payload bytes as a `std::array` non-type argument.
+ * @return Encoded delimited frame as `std::array<uint8_t, exact size>`.
+ */
+template<std::array Frame>
+consteval auto cobs_encode_static()
+{
+    constexpr size_t size = cobs_encode_size({Frame.data(), Frame.size()}) + 1;
+    std::array<uint8_t, size> out = {};
+    cobs_encode({Frame.data(), Frame.size()}, out.begin());
+    out[size - 1] = 0;
+    return out;
+}
+
+/**
+ * @brief Encode a constant frame given directly as byte template arguments.
+ *
+ * Convenience form of `cobs_encode_static<Frame>()` for short literal
+ * frames: `cobs_encode_static<0x11, 0x22, 0x00>()`.
+ *
+ * @tparam Bytes Payload bytes.
+ * @return Encoded delimited frame as `std::array<uint8_t, exact size>`.
+ */
+template<uint8_t... Bytes>
+consteval auto cobs_encode_static()
+{
+    return cobs_encode_static<std::array<uint8_t, sizeof...(Bytes)>{ Bytes... }>();
+}
+
+/**
+ * @brief Owning right-sized encoded frame carved from an allocator.
+ *
+ * Move-only RAII owner returned by `cobs_encode_alloc()`: holds exactly
+ * the encoded delimited frame, no worst-case slack, and returns the
+ * bytes to the allocator it was carved from on destruction.
+ *
+ * @tparam A Allocator type the frame was allocated with.
+ */
+template<class A = std::allocator<uint8_t>>
+struct cobs_frame_buf_t {
+
+    using alloc_t = typename std::allocator_traits<A>::template rebind_alloc<uint8_t>;
+
+    constexpr cobs_frame_buf_t() = default;
+    constexpr cobs_frame_buf_t(uint8_t* buf, size_t len, alloc_t alloc)
+        : buf(buf), len(len), alloc(std::move(alloc))
+    {}
+    constexpr cobs_frame_buf_t(cobs_frame_buf_t&& other) noexcept
+        : buf(std::exchange(other.buf, nullptr))
+        , len(std::exchange(other.len, 0))
+        , alloc(std::move(other.alloc))
+    {}
+    constexpr cobs_frame_buf_t& operator=(cobs_frame_buf_t&& other) noexcept
+    {
+        if (this != &other) {
+            release();
+            buf = std::exchange(other.buf, nullptr);
+            len = std::exchange(other.len, 0);
+            alloc = std::move(other.alloc);
+        }
+        return *this;
+    }
+    cobs_frame_buf_t(const cobs_frame_buf_t&) = delete;
+    cobs_frame_buf_t& operator=(const cobs_frame_buf_t&) = delete;
+
+    constexpr ~cobs_frame_buf_t()
+    {
+        release();
+    }
+
+    constexpr const uint8_t* data() const   { return buf; }
+    constexpr size_t size() const           { return len; }
+    constexpr bool empty() const            { return !len; }
+    constexpr std::span<const uint8_t> span() const
+    {
+        return { buf, len };
+    }
+
+protected:
+
+    constexpr void release()
+    {
+        if (buf)
+            std::allocator_traits<alloc_t>::deallocate(alloc, buf, len);
+    }
+
+    uint8_t* buf = nullptr;
+    size_t len = 0;
+    [[no_unique_address]] alloc_t alloc = {};
+};
+
+/**
+ * @brief Encode into a right-sized owning buffer from a caller allocator.
+ *
+ * The send-path "encode this payload and hand me an owning frame"
+ * builder: sizes the frame exactly with the write-free scan, carves
+ * that many bytes from the supplied arena/pmr-style allocator — no
+ * `cobs_encode_max_size` over-allocation, no shrink — and encodes with
+ * the fast kernel straight into them.
+ *
+ * @note Unlike the buffer overloads, the trailing `0x00` delimiter IS
+ * included: the returned frame is ready to transmit as-is.
+ *
+ * @param in Input bytes to encode.
+ * @param alloc Allocator providing the frame storage.
+ * @return Owning encoded delimited frame, see `cobs_frame_buf_t`.
+ */
+template<class A = std::allocator<uint8_t>>
+constexpr cobs_frame_buf_t<A> cobs_encode_alloc(std::span<const uint8_t> in, A alloc = {})
+{
+    using alloc_t = typename cobs_frame_buf_t<A>::alloc_t;
+
+    alloc_t a{std::move(alloc)};
+    size_t size = cobs_encode_size(in) + 1;
+    uint8_t* buf = std::allocator_traits<alloc_t>::allocate(a, size);
+    if (std::is_constant_evaluated()) {
+        for (size_t i = 0; i < size; ++i)
+            std::construct_at(buf + i, uint8_t(0));
+    }
+    cobs_encode(in, std::span<uint8_t>{buf, size});
+    buf[size - 1] = 0;
+    return { buf, size, std::move(a) };
+}
+
+/**
+ * @brief Concept for a callable that writes decoded COBS output.
+ * 
+ * @tparam W Callable to write decoded chunk when ready.
+ * @param data Pointer to decoded bytes.
+ * @param size Number of decoded bytes.
+ * @param left Number of bytes left to receive if delimiter came prematurely.
+ */
+template<class W>
+concept CobsDecodeCb = std::is_invocable_r_v<void, W&, const uint8_t*, size_t, size_t>;
+
+/**
+ * @brief Statistics counters of `cobs_decoder_t` with the stats facet on.
+ *
+ */
+struct cobs_decoder_stats_t {
+    size_t bytes_in = 0;    ///< Encoded bytes sunk, delimiters included.
+    size_t bytes_out = 0;   ///< Decoded payload bytes handed to callbacks.
+    size_t frames = 0;      ///< Frames terminated via delimiter or `stop()`.
+    size_t malformed = 0;   ///< Frames terminated with missing bytes, the `left > 0` path.
+};
+
+/**
+ * @brief Streaming COBS decoder with internal buffering.
+ * 
+ * Designed for scenarios where data arrives in fragments and needs to be decoded 
+ * on-the-fly without preallocating large output buffers. You may either feed the 
+ * terminator `0x00` via `sink()` as part of the input stream, or omit it and call 
+ * `stop(cb)` at the end of a frame. On termination, the callback receives one final 
+ * chunk with number of missing payload bytes in the last block: `left == 0` for a 
+ * well-formed frame, `left > 0` for a malformed or truncated frame. After termination,
+ * the decoder resets and is ready for the next frame.
+ *
+ * The block size must match the encoder on the other end of the link:
+ * code `N + 1` marks a full block with no trailing zero, the default of
+ * 254 is standard COBS. Oversized blocks from a mismatched sender are
+ * still consumed safely, handed to the callback in multiple chunks.
+ *
+ * With `Stats` enabled the instance keeps `cobs_decoder_stats_t`
+ * counters, readable via `stats()`, e.g. to spot a link sending
+ * malformed frames; disabled, the facet costs no storage and no
+ * instructions.
+ *
+ * With `Reduced` enabled, frames are treated as COBS/R: a final code
+ * byte implying more data than received is the folded final data byte,
+ * not a truncation. Classic frames still decode unchanged, but real
+ * truncations go undetected, so protect frames with a CRC.
+ *
+ * @tparam N Maximum data bytes per block, 1..254, default 254.
+ * @tparam Stats Enable the per-instance statistics facet.
+ * @tparam Reduced Accept COBS/R framing on termination.
+ */
+template<size_t N = 254, bool Stats = false, bool Reduced = false>
+struct cobs_decoder_t {
+
+    static_assert(N >= 1 && N <= 254, "COBS block size must be 1..254");
+
+    /**
+     * @brief Reset internal state, statistics included.
+     *
+     */
+    constexpr void reset()
+    {
+        size = 0;
+        done = 0;
+        code = 0;
+        stat = {};
+    }
+
+    /**
+     * @brief Read the statistics counters.
+     *
+     */
+    constexpr const cobs_decoder_stats_t& stats() const requires (Stats)
+    {
+        return stat;
+    }
+
+    /**
+     * @brief Sink incoming data using a generic callable.
+     *
+     * @param in Input data.
+     * @param cb Callable to handle decoded chunk when ready.
+     */
+    constexpr void sink(std::span<const uint8_t> in, CobsDecodeCb auto&& cb)
+    {
+        if constexpr (Stats)
+            stat.bytes_in += in.size();
+        auto& wr = cb;
+        for (auto b : in) step(b, wr);
+    }
+
+    /**
+     * @brief Finalize current frame without requiring a delimiter byte.
+     *
+     * Invokes the callback once with the buffered data and the computed
+     * leftover count. After this call the internal state is reset.
+     *
+     * @param cb Callable to handle decoded chunk when ready.
+     */
+    NTH_COBS_NOINLINE_ATTR constexpr void stop(CobsDecodeCb auto&& cb)
+    {
+        size_t left = code ? code - done - size - 1u : 0u;
+        if constexpr (Reduced) {
+            if (left) { // Folded tail: the code byte is the final data byte
+                buf[size++] = code;
+                left = 0;
+            }
+        }
+        if constexpr (Stats) {
+            ++stat.frames;
+            stat.bytes_out += size;
+            if (left)
+                ++stat.malformed;
+        }
+        std::invoke(cb, buf, size, left);
+        size = 0;
+        done = 0;
+        code = 0;
+    }
+
+protected:
+
+    /**
+     * @brief Decode single byte using a generic callable.
+     *
+     * @param b Input byte.
      * @param cb Callable to handle decoded chunk when ready.
      */
+    NTH_COBS_NOINLINE_ATTR constexpr void step(uint8_t b, CobsDecodeCb auto& cb)
+    {
+        if (b == 0x00) {
+            stop(cb);
+            return;
+        }
+        if (!code || done + size + 1 == code) {
+            if (code && code != N + 1)
+                buf[size++] = 0;
+            if constexpr (Stats)
+                stat.bytes_out += size;
+            std::invoke(cb, buf, size, 0);
+            size = 0;
+            done = 0;
+            code = b;
+        } else {
+            if (size == N) { // Buffer full mid-block, hand over a partial chunk
+                if constexpr (Stats)
+                    stat.bytes_out += size;
+                std::invoke(cb, buf, size, 0);
+                done += size;
+                size = 0;
+            }
+            buf[size++] = b;
+        }
+    }
+
+    uint8_t size = 0;
+    uint8_t done = 0;
+    uint8_t code = 0;
+    uint8_t buf[N + 1] = {};
+    [[no_unique_address]] std::conditional_t<Stats, cobs_decoder_stats_t, cobs_stats_none_t> stat = {};
+};
+
+/**
+ * @brief Streaming COBS decoder that forwards chunks of the input span.
+ *
+ * Unlike `cobs_decoder_t`, payload bytes are never copied into internal
+ * storage: the callback receives pointers directly into the span passed
+ * to `sink()`, so the handed chunks are only valid for the duration of
+ * that call. A block that straddles sink calls is simply delivered as
+ * multiple chunks; the only state kept across calls is the block walk
+ * itself. Termination semantics match `cobs_decoder_t`: feed the `0x00`
+ * delimiter via `sink()` or call `stop()`, and the callback receives a
+ * final empty chunk with the number of missing payload bytes in `left`.
+ *
+ */
+struct cobs_decoder_view_t {
+
+    /**
+     * @brief Reset internal state.
+     *
+     */
+    constexpr void reset()
+    {
+        code = 0;
+        block = 0;
+    }
+
+    /**
+     * @brief Sink incoming data, forwarding decoded chunks out of it.
+     *
+     * @param in Input data, referenced by the callback until it returns.
+     * @param cb Callable to handle decoded chunk when ready.
+     */
+    constexpr void sink(std::span<const uint8_t> in, CobsDecodeCb auto&& cb)
+    {
+        const uint8_t* src = in.data();
+        const uint8_t* end = in.data() + in.size();
+        const uint8_t zero = 0;
+
+        while (src < end) {
+            if (block) {
+                size_t avail = end - src;
+                size_t chunk = block < avail ? block : avail;
+                std::invoke(cb, src, chunk, 0u);
+                block -= chunk;
+                src += chunk;
+            } else {
+                uint8_t b = *src++;
+                if (!b) {
+                    stop(cb);
+                    continue;
+                }
+                if (code && code != 0xff)
+                    std::invoke(cb, &zero, 1u, 0u);
+                code = b;
+                block = b - 1u;
+            }
+        }
+    }
+
+    /**
+     * @brief Finalize current frame without requiring a delimiter byte.
+     *
+     * Invokes the callback once with an empty chunk and the computed
+     * leftover count. After this call the internal state is reset.
+     *
+     * @param cb Callable to handle decoded chunk when ready.
+     */
+    NTH_COBS_NOINLINE_ATTR constexpr void stop(CobsDecodeCb auto&& cb)
+    {
+        std::invoke(cb, nullptr, 0u, size_t(block));
+        reset();
+    }
+
+protected:
+
+    uint8_t code = 0;
+    uint8_t block = 0;
+};
+
+/**
+ * @brief Streaming decoder accumulating whole frames, one callback per frame.
+ *
+ * `cobs_decoder_t` hands out one chunk per block, so application frames
+ * spanning many blocks get reassembled in the callback with one more
+ * copy. This variant decodes straight into a single frame buffer and
+ * invokes the callback exactly once per frame — at each in-stream
+ * `0x00` delimiter or explicit `stop()` — with the complete decoded
+ * payload and `left` semantics matching `cobs_decoder_t`. Blocks are
+ * consumed with bulk copies rather than a byte loop. A frame that
+ * outgrows `MaxFrame` is dropped, counted in `dropped()`, and decoding
+ * resynchronizes at the next delimiter.
+ *
+ * @tparam MaxFrame Frame buffer size, the longest decoded frame handled.
+ */
+template<size_t MaxFrame = 4096>
+struct cobs_frame_decoder_t {
+
+    static_assert(MaxFrame >= 1, "frame buffer must hold at least one byte");
+
+    /**
+     * @brief Reset internal state, including the dropped frame counter.
+     *
+     */
+    constexpr void reset()
+    {
+        code = 0;
+        block = 0;
+        size = 0;
+        drop = false;
+        lost = 0;
+    }
+
+    /**
+     * @brief Number of frames dropped for outgrowing the frame buffer.
+     *
+     */
+    constexpr size_t dropped() const
+    {
+        return lost;
+    }
+
+    /**
+     * @brief Sink incoming data, delivering each completed frame whole.
+     *
+     * @param in Input data. Can optionally contain `0x00` delimiters,
+     * then a separate call to `stop()` is not necessary.
+     * @param cb Callable to handle one decoded frame at a time.
+     */
     constexpr void sink(std::span<const uint8_t> in, CobsDecodeCb auto&& cb)
     {
-        auto& wr = cb;
-        for (auto b : in) step(b, wr);
+        const uint8_t* src = in.data();
+        const uint8_t* end = in.data() + in.size();
+        const uint8_t zero = 0;
+
+        while (src < end) {
+            if (block) {
+                size_t avail = size_t(end - src);
+                size_t chunk = block < avail ? block : avail;
+                store(src, chunk);
+                block -= uint8_t(chunk);
+                src += chunk;
+            } else {
+                uint8_t b = *src++;
+                if (!b) {
+                    stop(cb);
+                    continue;
+                }
+                if (code && code != 0xff)
+                    store(&zero, 1);
+                code = b;
+                block = b - 1u;
+            }
+        }
     }
 
     /**
      * @brief Finalize current frame without requiring a delimiter byte.
      *
-     * Invokes the callback once with the buffered data and the computed
-     * leftover count. After this call the internal state is reset.
-     * 
-     * @param cb Callable to handle decoded chunk when ready.
+     * Invokes the callback once with the accumulated frame and the
+     * number of missing payload bytes in `left`, unless the frame was
+     * dropped for outgrowing the buffer. After this call the internal
+     * state is reset.
+     *
+     * @param cb Callable to handle one decoded frame at a time.
      */
     NTH_COBS_NOINLINE_ATTR constexpr void stop(CobsDecodeCb auto&& cb)
     {
-        std::invoke(cb, buf, size, code ? code - size - 1u : 0u);
-        reset();
+        if (drop)
+            ++lost; // Dropped frame ends here, resynchronize
+        else
+            std::invoke(cb, buf, size, size_t(block));
+        code = 0;
+        block = 0;
+        size = 0;
+        drop = false;
     }
 
 protected:
 
     /**
-     * @brief Decode single byte using a generic callable.
-     * 
-     * @param b Input byte.
-     * @param cb Callable to handle decoded chunk when ready.
+     * @brief Append decoded bytes to the frame, dropping on overflow.
+     *
+     * @param p Decoded bytes.
+     * @param n Number of decoded bytes.
      */
-    NTH_COBS_NOINLINE_ATTR constexpr void step(uint8_t b, CobsDecodeCb auto& cb)
+    constexpr void store(const uint8_t* p, size_t n)
     {
-        if (b == 0x00) {
-            stop(cb);
+        if (drop || size + n > MaxFrame) {
+            drop = true;
             return;
         }
-        if (!code || size + 1 == code) {
-            if (code && code != 0xff)
-                buf[size++] = 0;
-            std::invoke(cb, buf, size, 0);
-            size = 0;
-            code = b;
+        if (std::is_constant_evaluated()) {
+            for (size_t i = 0; i < n; ++i)
+                buf[size + i] = p[i];
         } else {
-            buf[size++] = b;
+            std::memcpy(buf + size, p, n);
         }
+        size += n;
     }
 
-    uint8_t size = 0;
+    size_t size = 0;
+    size_t lost = 0;
     uint8_t code = 0;
-    uint8_t buf[255] = {};
+    uint8_t block = 0;
+    bool drop = false;
+    uint8_t buf[MaxFrame] = {};
+};
+
+/**
+ * @brief Concept for a callable that receives segmented COBS frames.
+ *
+ * @tparam W Callable to handle one complete encoded frame.
+ * @param data Pointer to the encoded frame bytes, delimiter excluded.
+ * @param size Number of encoded frame bytes, never zero.
+ */
+template<class W>
+concept CobsFrameCb = std::is_invocable_r_v<void, W&, const uint8_t*, size_t>;
+
+/**
+ * @brief Incremental delimiter scanner segmenting a receive stream into frames.
+ *
+ * Splits incoming spans on `0x00` delimiters using the same vectorized
+ * zero search as the decoder, replacing the byte-wise boundary loop
+ * otherwise needed in application code. The callback receives one
+ * complete `[begin, end)` frame at a time, ready to pass to the
+ * `cobs_decode` span overload (with `cobs_decode_max_size()` of the
+ * handed size bounding the output). A frame lying entirely within one
+ * sink span is handed out zero-copy, pointing into the input; only a
+ * frame that straddles sink calls is staged in the internal buffer.
+ * Consecutive delimiters are skipped as inter-frame padding. A buffered
+ * frame that outgrows `N` is dropped, counted in `dropped()`, and the
+ * scanner resynchronizes at the next delimiter.
+ *
+ * @tparam N Internal buffer size, the longest straddling frame handled.
+ */
+template<size_t N = 4096>
+struct cobs_frame_scanner_t {
+
+    static_assert(N >= 1, "internal buffer must hold at least one byte");
+
+    /**
+     * @brief Reset internal state, including the dropped frame counter.
+     *
+     */
+    constexpr void reset()
+    {
+        size = 0;
+        drop = false;
+        lost = 0;
+    }
+
+    /**
+     * @brief Number of frames dropped for outgrowing the internal buffer.
+     *
+     */
+    constexpr size_t dropped() const
+    {
+        return lost;
+    }
+
+    /**
+     * @brief Sink incoming data, handing out every completed frame.
+     *
+     * @param in Input data, referenced by the callback until it returns.
+     * @param cb Callable to handle one complete frame, delimiter excluded.
+     * @return Number of frames handed to the callback.
+     */
+    constexpr size_t sink(std::span<const uint8_t> in, CobsFrameCb auto&& cb)
+    {
+        const uint8_t* src = in.data();
+        size_t left = in.size();
+        size_t frames = 0;
+
+        while (true) {
+            size_t len = impl::cobs_find_zero(src, left);
+            if (len == left) { // No delimiter, stash the partial frame
+                store(src, len);
+                return frames;
+            }
+            if (drop) {
+                drop = false; // Resynchronized on the delimiter
+            } else if (size) {
+                store(src, len);
+                if (size) {
+                    std::invoke(cb, buf, size);
+                    ++frames;
+                }
+                drop = false;
+                size = 0;
+            } else if (len) {
+                std::invoke(cb, src, len); // Whole frame inside this sink span, zero-copy
+                ++frames;
+            }
+            src += len + 1;
+            left -= len + 1;
+        }
+    }
+
+    /**
+     * @brief Finalize the stream, handing out a trailing undelimited frame.
+     *
+     * The library treats the trailing `0x00` delimiter as optional, so
+     * bytes pending at end of stream form a complete frame. After this
+     * call the frame state is reset, the dropped counter is kept.
+     *
+     * @param cb Callable to handle one complete frame.
+     * @return Number of frames handed to the callback, 0 or 1.
+     */
+    NTH_COBS_NOINLINE_ATTR constexpr size_t stop(CobsFrameCb auto&& cb)
+    {
+        size_t frames = 0;
+        if (size && !drop) {
+            std::invoke(cb, buf, size);
+            ++frames;
+        }
+        size = 0;
+        drop = false;
+        return frames;
+    }
+
+protected:
+
+    /**
+     * @brief Append partial frame bytes to the internal buffer.
+     *
+     * @param src Input bytes.
+     * @param len Number of input bytes.
+     */
+    constexpr void store(const uint8_t* src, size_t len)
+    {
+        if (drop)
+            return;
+        if (size + len > N) {
+            drop = true; // Frame outgrew the buffer, discard up to the next delimiter
+            size = 0;
+            ++lost;
+            return;
+        }
+        if (std::is_constant_evaluated()) {
+            for (size_t i = 0; i < len; ++i)
+                buf[size + i] = src[i];
+        } else {
+            std::memcpy(buf + size, src, len);
+        }
+        size += len;
+    }
+
+    size_t size = 0;
+    bool drop = false;
+    size_t lost = 0;
+    uint8_t buf[N] = {};
 };
 
 /**
@@ -341,9 +1738,10 @@ NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_decode(std::span<const uint8_t> in,
             code = block;
             if (!code)
                 break;
+            --block; // Only the code byte consumes a block slot here; a
+                     // partial chunk above means truncated input, whose
+                     // shortfall must stay intact for the left report
         }
-        if (block)
-            --block;
     }
     if (block) {
         std::invoke(cb, nullptr, 0u, block);
@@ -365,6 +1763,9 @@ NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_decode(std::span<const uint8_t> in,
  */
 NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_decode(std::span<const uint8_t> in, std::span<uint8_t> out) noexcept
 {
+    if (!std::is_constant_evaluated())
+        return impl::cobs_decode_fast(in, out);
+
     const uint8_t* src = in.data();
     const uint8_t* end = in.data() + in.size();
     uint8_t* dst = out.data();
@@ -395,6 +1796,421 @@ NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_decode(std::span<const uint8_t> in,
     return block ? 0u : required;
 }
 
+/**
+ * @brief Validate a frame and compute its exact decoded size, write-free.
+ *
+ * Walks only the code-byte chain, striding over data bytes, so roughly
+ * 1/254th of the input is touched. Pairs with `cobs_decode_unchecked`:
+ * validate untrusted input first, then decode into an exactly-sized
+ * buffer with no per-byte bounds checks.
+ *
+ * @note Like `cobs_decode`, a well-formed empty frame also yields 0;
+ * disambiguate with `in.size() == 1 && in[0] == 0x01` when needed.
+ *
+ * @param in Input to validate, trailing `0x00` is optional.
+ * @return Exact decoded size, 0 if the input is malformed.
+ */
+NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_validate(std::span<const uint8_t> in) noexcept
+{
+    size_t pos = 0;
+    size_t size = 0;
+    uint8_t code = 0xff;
+
+    while (pos < in.size()) {
+        uint8_t c = in[pos];
+        if (!c)
+            break; // Delimiter terminates the frame
+        if (code != 0xff)
+            ++size; // Implied zero between blocks
+        code = c;
+        size_t want = size_t(c) - 1;
+        if (want > in.size() - pos - 1)
+            return 0u; // Block truncated by end of input
+        size += want;
+        pos += want + 1;
+    }
+    return size;
+}
+
+/**
+ * @brief Decode with COBS through an output iterator.
+ *
+ * No callable sits in the loop and no per-byte bounds check is done on
+ * the output, so decoding a small frame compiles down to straight-line
+ * code. The caller guarantees capacity for `cobs_decode_max_size()`
+ * bytes of the input size; termination semantics match the span
+ * overload, including the optional trailing `0x00` delimiter.
+ *
+ * @param in Input to decode, trailing `0x00` is optional.
+ * @param out Output iterator receiving decoded bytes.
+ * @return Number of decoded bytes written, 0 if the input is malformed.
+ */
+template<std::output_iterator<uint8_t> O>
+NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_decode(std::span<const uint8_t> in, O out)
+{
+    const uint8_t* src = in.data();
+    const uint8_t* end = in.data() + in.size();
+    uint8_t code = 0xff;
+    uint8_t block = 0;
+    size_t written = 0;
+
+    while (src < end) {
+        if (block) {
+            *out++ = *src++;
+            ++written;
+        } else {
+            block = *src++;
+            if (block && (code != 0xff)) {
+                *out++ = 0;
+                ++written;
+            }
+            code = block;
+            if (!code)
+                break;
+        }
+        --block;
+    }
+    return block ? 0u : written;
+}
+
+/**
+ * @brief Decode with COBS into a buffer, tapping the payload in one pass.
+ *
+ * Behaves like `cobs_decode(in, out)`, but additionally hands each
+ * decoded payload chunk to `tap` as the block walk produces it, fusing
+ * e.g. the frame CRC check into the single decode traversal. Chunks are
+ * fed from the input (data bytes pass through encoding unchanged), so
+ * the tap sees the full payload even when the output buffer is too
+ * small. On malformed input the tap may have observed a prefix.
+ *
+ * @param in Input to decode, trailing `0x00` is optional.
+ * @param out Output buffer.
+ * @param tap Callable observing consecutive decoded payload chunks.
+ * @return Required number of decoded bytes or 0 if the input is malformed.
+ */
+NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_decode(std::span<const uint8_t> in, std::span<uint8_t> out, CobsTapCb auto&& tap)
+{
+    const uint8_t* src = in.data();
+    const uint8_t* end = in.data() + in.size();
+    uint8_t* dst = out.data();
+    uint8_t* dst_end = out.data() + out.size();
+    uint8_t code = 0xff;
+    size_t required = 0;
+
+    const uint8_t zero = 0;
+
+    while (src < end) {
+        uint8_t c = *src++;
+        if (!c)
+            break; // Delimiter terminates the frame
+        if (code != 0xff) {
+            if (dst < dst_end)
+                *dst++ = 0;
+            ++required;
+            std::invoke(tap, &zero, 1u); // Implied zero between blocks
+        }
+        code = c;
+        size_t want = size_t(c) - 1;
+        if (want > size_t(end - src))
+            return 0u; // Block truncated by end of input
+        size_t room = size_t(dst_end - dst);
+        size_t fit = want < room ? want : room;
+        if (std::is_constant_evaluated()) {
+            for (size_t i = 0; i < fit; ++i)
+                dst[i] = src[i];
+        } else {
+            std::memcpy(dst, src, fit);
+        }
+        dst += fit;
+        required += want;
+        if (want)
+            std::invoke(tap, src, want);
+        src += want;
+    }
+    return required;
+}
+
+/**
+ * @brief Decode with COBS into guaranteed-capacity storage.
+ *
+ * Skips the per-byte output bounds checks of the span overload, so each
+ * block is consumed with one unclamped bulk copy: the trusted-path
+ * variant for frames whose size is already known, e.g. CRC-verified
+ * input sized via `cobs_validate()` or `cobs_decode_max_size()`. The
+ * caller guarantees output capacity; input truncation is still detected
+ * per block and returns 0 without reading out of bounds.
+ *
+ * @param in Input to decode, trailing `0x00` is optional.
+ * @param out Output storage with capacity for the decoded size.
+ * @return Number of decoded bytes, 0 if the input is malformed.
+ */
+NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_decode_unchecked(std::span<const uint8_t> in, uint8_t* out) noexcept
+{
+    if (std::is_constant_evaluated())
+        return cobs_decode(in, out); // Output iterator overload, already unchecked
+
+    const uint8_t* src = in.data();
+    const uint8_t* end = in.data() + in.size();
+    uint8_t* dst = out;
+    uint8_t code = 0xff;
+
+    while (src < end) {
+        uint8_t c = *src++;
+        if (!c)
+            break; // Delimiter terminates the frame
+        if (code != 0xff)
+            *dst++ = 0;
+        code = c;
+        size_t want = size_t(c) - 1;
+        if (want > size_t(end - src))
+            return 0u; // Block truncated by end of input
+        std::memcpy(dst, src, want);
+        dst += want;
+        src += want;
+    }
+    return size_t(dst - out);
+}
+
+/**
+ * @brief Decode a COBS/R (reduced) frame into an output buffer.
+ *
+ * Walks blocks like the classic decoder; when the final code byte
+ * implies more data than the frame holds, that code byte itself is the
+ * folded final data byte and is appended after the remaining bytes.
+ * Classic frames decode unchanged, so one receiver handles both.
+ * Truncated-output semantics match `cobs_decode(in, out)`.
+ *
+ * @note COBS/R gives up truncation detection: a frame cut mid-block is
+ * indistinguishable from a folded one, so protect frames with a CRC.
+ *
+ * @param in Input to decode, a single frame, trailing `0x00` optional.
+ * @param out Output buffer.
+ * @return Required number of decoded bytes.
+ */
+NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_r_decode(std::span<const uint8_t> in, std::span<uint8_t> out) noexcept
+{
+    if (!in.empty() && in.back() == 0x00)
+        in = in.first(in.size() - 1); // Strip the optional delimiter
+
+    const uint8_t* src = in.data();
+    const uint8_t* end = in.data() + in.size();
+    uint8_t* dst = out.data();
+    uint8_t* dst_end = out.data() + out.size();
+    uint8_t code = 0xff;
+    size_t required = 0;
+
+    while (src < end) {
+        uint8_t c = *src++;
+        if (!c)
+            break; // Premature delimiter terminates the frame
+        if (code != 0xff) {
+            if (dst < dst_end)
+                *dst++ = 0;
+            ++required;
+        }
+        size_t want = size_t(c) - 1;
+        if (want > size_t(end - src)) { // Folded tail: the code byte is the final data byte
+            while (src < end) {
+                if (dst < dst_end)
+                    *dst++ = *src;
+                ++src;
+                ++required;
+            }
+            if (dst < dst_end)
+                *dst++ = c;
+            return required + 1;
+        }
+        code = c;
+        for (size_t i = 0; i < want; ++i) {
+            if (dst < dst_end)
+                *dst++ = src[i];
+            ++required;
+        }
+        src += want;
+    }
+    return required;
+}
+
+/**
+ * @brief Encode with COBS in place, using headroom below the payload.
+ *
+ * Encodes a payload placed at `buf[payload_offset, buf.size())` into the
+ * front of the same buffer, writing code bytes into the headroom, so no
+ * second full-size buffer is needed. The rewrite runs front to back and
+ * never overwrites a payload byte that has not been consumed yet; if the
+ * headroom is insufficient for that (or for the encoded size), the buffer
+ * is left untouched. A headroom of `1 + payload_size / 254` bytes is
+ * always sufficient.
+ *
+ * @note Does NOT write the final `0x00` delimiter.
+ *
+ * @param buf Buffer holding the payload at `payload_offset`, receives encoded bytes at offset 0.
+ * @param payload_offset Offset of the payload within `buf`, must be >= 1.
+ * @return Number of encoded bytes, 0 if the headroom is insufficient.
+ */
+NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_encode_inplace(std::span<uint8_t> buf, size_t payload_offset) noexcept
+{
+    if (!payload_offset || payload_offset > buf.size())
+        return 0;
+
+    auto pass = [&] (bool write) -> size_t {
+        size_t src = payload_offset;
+        size_t dst_len = 0;
+        size_t dst_dat = 1;
+        uint8_t code = 1;
+        size_t required = 1;
+        while (src < buf.size()) {
+            uint8_t b = buf[src++];
+            if (b) {
+                if (dst_dat >= src)
+                    return 0; // Would overwrite a not yet consumed payload byte
+                if (write)
+                    buf[dst_dat] = b;
+                ++dst_dat;
+                ++code;
+                ++required;
+            }
+            if (code == 0xff || !b) {
+                if (dst_len >= src)
+                    return 0;
+                if (write)
+                    buf[dst_len] = code;
+                dst_len = dst_dat;
+                code = 1;
+                if (!b || src < buf.size()) {
+                    ++dst_dat;
+                    ++required;
+                }
+            }
+        }
+        if (required > buf.size())
+            return 0;
+        if (write && dst_len < buf.size()) // No trailing code slot when input ends on a full block
+            buf[dst_len] = code;
+        return required;
+    };
+    if (!pass(false)) // Dry run so a failed attempt never damages the payload
+        return 0;
+    return pass(true);
+}
+
+/**
+ * @brief Decode with COBS in place.
+ *
+ * Decoding is strictly shrinking, so the payload is rebuilt at the front
+ * of the same buffer with no extra storage.
+ *
+ * @param buf Buffer with encoded input, trailing `0x00` is optional, receives decoded bytes at offset 0.
+ * @return Number of decoded bytes or 0 if the input is malformed.
+ */
+NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_decode_inplace(std::span<uint8_t> buf) noexcept
+{
+    size_t src = 0;
+    size_t dst = 0;
+    uint8_t code = 0xff;
+
+    while (src < buf.size()) {
+        uint8_t c = buf[src++];
+        if (!c)
+            break;
+        if (code != 0xff)
+            buf[dst++] = 0;
+        code = c;
+        size_t want = size_t(c) - 1;
+        size_t avail = buf.size() - src;
+        size_t take = want < avail ? want : avail;
+        if (take) {
+            if (!std::is_constant_evaluated()) {
+                std::memmove(buf.data() + dst, buf.data() + src, take);
+            } else {
+                for (size_t i = 0; i < take; ++i)
+                    buf[dst + i] = buf[src + i];
+            }
+            dst += take;
+            src += take;
+        }
+        if (take < want)
+            return 0u; // Block truncated by end of input
+    }
+    return dst;
+}
+
+/**
+ * @brief Result of a batch decode operation.
+ *
+ */
+struct cobs_batch_t {
+    size_t size;    ///< Required number of output bytes, 0 if any frame was malformed.
+    size_t frames;  ///< Number of frames processed, index of the offending frame on failure.
+};
+
+/**
+ * @brief Encode multiple frames into one packed delimited stream.
+ *
+ * Amortizes per-frame setup cost when draining rings of small frames.
+ * Each frame is encoded back-to-back and, unlike the single-frame
+ * overloads, followed by its `0x00` delimiter, so the output is a
+ * ready-to-send stream. If the output buffer is too small, the function
+ * still returns the total required size, but writes only as many bytes
+ * as fit.
+ *
+ * @param frames Input frames to encode.
+ * @param out Output buffer for the packed delimited stream.
+ * @param offsets Optional per-frame offsets of each encoded frame within `out`.
+ * @return Required total number of encoded bytes including delimiters.
+ */
+NTH_COBS_NOINLINE_ATTR constexpr size_t cobs_encode_batch(std::span<const std::span<const uint8_t>> frames, std::span<uint8_t> out, std::span<size_t> offsets = {}) noexcept
+{
+    size_t pos = 0;
+    for (size_t i = 0; i < frames.size(); ++i) {
+        if (i < offsets.size())
+            offsets[i] = pos;
+        pos += cobs_encode(frames[i], pos < out.size() ? out.subspan(pos) : std::span<uint8_t>{});
+        if (pos < out.size())
+            out[pos] = 0;
+        ++pos;
+    }
+    return pos;
+}
+
+/**
+ * @brief Decode a stream of concatenated delimited frames in one call.
+ *
+ * Splits the input on `0x00` delimiters and decodes each frame into a
+ * packed output buffer. A trailing frame without delimiter is decoded
+ * as well; consecutive delimiters (zero-length segments) are skipped
+ * as inter-frame padding. If the output buffer is too small, the
+ * function still returns the total required size, but writes only as
+ * many bytes as fit.
+ *
+ * @param in Input stream of delimited frames.
+ * @param out Output buffer for the packed decoded payloads.
+ * @param offsets Optional per-frame offsets of each decoded payload within `out`.
+ * @return Required total size and frame count, see `cobs_batch_t`.
+ */
+NTH_COBS_NOINLINE_ATTR constexpr cobs_batch_t cobs_decode_batch(std::span<const uint8_t> in, std::span<uint8_t> out, std::span<size_t> offsets = {}) noexcept
+{
+    size_t pos = 0;
+    size_t idx = 0;
+    size_t off = 0;
+
+    while (off < in.size()) {
+        size_t len = impl::cobs_find_zero(in.data() + off, in.size() - off);
+        if (len) {
+            auto frame = in.subspan(off, len);
+            size_t size = cobs_decode(frame, pos < out.size() ? out.subspan(pos) : std::span<uint8_t>{});
+            if (!size && !(len == 1 && frame[0] == 0x01))
+                return { 0, idx }; // Malformed frame, report its index
+            if (idx < offsets.size())
+                offsets[idx] = pos;
+            pos += size;
+            ++idx;
+        }
+        off += len + 1;
+    }
+    return { pos, idx };
+}
+
 }
 
 #endif
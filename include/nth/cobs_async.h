@@ -0,0 +1,273 @@
+/*
+ *   Copyright (C) 2025 Ilya Makarov <ilya.makarov.592@gmail.com> (@nth-eye).
+ *   All rights reserved.
+ */
+
+#ifndef NTH_COBS_ASYNC_H
+#define NTH_COBS_ASYNC_H
+
+#include <nth/cobs.h>
+#include <coroutine>
+#include <exception>
+
+namespace nth {
+
+/**
+ * @brief Minimal eager fire-and-forget task for the coroutine adapters.
+ *
+ * Starts immediately and runs until its first suspension point, after
+ * which it is resumed from `feed()`/`drain()` on the streams below. The
+ * handle is not owned: a consumer or writer coroutine lives as long as
+ * it keeps awaiting, and simply finishes on `co_return`.
+ */
+struct cobs_task_t {
+    struct promise_type {
+        cobs_task_t get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+/**
+ * @brief Coroutine-native decode stream yielding whole frames.
+ *
+ * Replaces the sink-callback-queue-pop state machine of async ingest
+ * loops: a consumer coroutine awaits `next()` and receives one decoded
+ * frame span per resumption, while the I/O loop pushes raw encoded
+ * spans with `feed()` as reads complete. Segmentation reuses
+ * `cobs_frame_scanner_t`, so frames are split with the vectorized zero
+ * search and only sink-straddling frames are staged. Each completed
+ * frame is decoded into the internal buffer and the awaiting consumer
+ * is resumed synchronously, running until its next await, so no queue
+ * and no allocation sit between decode and processing. Single consumer;
+ * a frame completed while no consumer awaits overwrites the pending
+ * one, and malformed or oversized frames are skipped, both counted in
+ * `dropped()`.
+ *
+ * @tparam N Frame capacity in bytes, encoded and decoded.
+ */
+template<size_t N = 4096>
+struct cobs_decode_stream_t {
+
+    struct awaiter_t {
+        cobs_decode_stream_t& s;
+        bool await_ready() const noexcept
+        {
+            return s.ready;
+        }
+        void await_suspend(std::coroutine_handle<> h) noexcept
+        {
+            s.waiter = h;
+        }
+        std::span<const uint8_t> await_resume() noexcept
+        {
+            s.ready = false;
+            return { s.frame, s.size };
+        }
+    };
+
+    /**
+     * @brief Await the next decoded frame, consumer side.
+     *
+     * @return Awaitable yielding a frame span, valid until the next await.
+     */
+    awaiter_t next() noexcept
+    {
+        return { *this };
+    }
+
+    /**
+     * @brief Push raw encoded bytes from the I/O loop, producer side.
+     *
+     * @param in Encoded input span, any framing alignment.
+     * @return Number of frames delivered to the consumer.
+     */
+    size_t feed(std::span<const uint8_t> in)
+    {
+        size_t delivered = 0;
+        scanner.sink(in, [&] (const uint8_t* enc, size_t len) {
+            delivered += deliver(enc, len);
+        });
+        return delivered;
+    }
+
+    /**
+     * @brief Finalize the stream, flushing a trailing undelimited frame.
+     *
+     * @return Number of frames delivered to the consumer, 0 or 1.
+     */
+    size_t stop()
+    {
+        size_t delivered = 0;
+        scanner.stop([&] (const uint8_t* enc, size_t len) {
+            delivered += deliver(enc, len);
+        });
+        return delivered;
+    }
+
+    /**
+     * @brief Number of frames lost to overflow, malformation or overwrite.
+     *
+     */
+    size_t dropped() const
+    {
+        return lost + scanner.dropped();
+    }
+
+protected:
+
+    /**
+     * @brief Decode one complete encoded frame and resume the consumer.
+     *
+     * @param enc Encoded frame bytes, delimiter excluded.
+     * @param len Number of encoded frame bytes.
+     * @return 1 if the frame reached the consumer, 0 if dropped.
+     */
+    size_t deliver(const uint8_t* enc, size_t len)
+    {
+        size_t n = cobs_validate({enc, len}); // Write-free, a drop must not touch a pending frame
+        if (n > N || (!n && !(len == 1 && enc[0] == 0x01))) {
+            ++lost; // Oversized or malformed frame
+            return 0;
+        }
+        if (ready)
+            ++lost; // Pending frame never consumed, overwritten
+        cobs_decode_unchecked({enc, len}, frame);
+        size = n;
+        ready = true;
+        if (waiter) {
+            auto h = waiter;
+            waiter = {};
+            h.resume(); // Consumer runs until its next await
+        }
+        return 1;
+    }
+
+    cobs_frame_scanner_t<N> scanner = {};
+    std::coroutine_handle<> waiter = {};
+    size_t size = 0;
+    size_t lost = 0;
+    bool ready = false;
+    uint8_t frame[N] = {};
+};
+
+/**
+ * @brief Awaitable encode sink with backpressure on a bounded buffer.
+ *
+ * The writer coroutine awaits `write(payload)`: when the exact encoded
+ * size (write-free scan) fits in the remaining buffer space, the frame
+ * is encoded with `cobs_encoder_t` plus its `0x00` delimiter and the
+ * coroutine continues without suspending; otherwise it parks until the
+ * I/O loop calls `drain()`, which hands the buffered stream to a
+ * callable, resets the buffer and resumes the writer. Single writer;
+ * a payload whose encoded frame exceeds the whole buffer can never fit
+ * and is skipped, counted in `dropped()`.
+ *
+ * @tparam N Buffer capacity in bytes of encoded delimited frames.
+ */
+template<size_t N = 4096>
+struct cobs_encode_stream_t {
+
+    struct awaiter_t {
+        cobs_encode_stream_t& s;
+        std::span<const uint8_t> payload;
+        bool await_ready() const noexcept
+        {
+            return cobs_encode_size(payload) + 1 > N || s.fits(payload);
+        }
+        void await_suspend(std::coroutine_handle<> h) noexcept
+        {
+            s.waiter = h;
+        }
+        void await_resume() noexcept
+        {
+            s.push(payload);
+        }
+    };
+
+    /**
+     * @brief Await room for one payload and encode it, writer side.
+     *
+     * @param payload Payload bytes, referenced until the await completes.
+     * @return Awaitable completing once the frame has been buffered.
+     */
+    awaiter_t write(std::span<const uint8_t> payload) noexcept
+    {
+        return { *this, payload };
+    }
+
+    /**
+     * @brief Hand the buffered stream out and resume the writer, I/O side.
+     *
+     * The callable sees the bytes before the buffer is reset, so it may
+     * send them without a copy; the parked writer resumes afterwards.
+     *
+     * @param cb Callable to handle the encoded delimited stream.
+     * @return Number of encoded bytes handed out.
+     */
+    size_t drain(CobsEncodeCb auto&& cb)
+    {
+        size_t size = fill;
+        if (size)
+            std::invoke(cb, buf, size);
+        fill = 0;
+        if (waiter) {
+            auto h = waiter;
+            waiter = {};
+            h.resume(); // Writer retries its parked frame, then runs until its next await
+        }
+        return size;
+    }
+
+    /**
+     * @brief Number of payloads skipped for never fitting the buffer.
+     *
+     */
+    size_t dropped() const
+    {
+        return lost;
+    }
+
+protected:
+
+    /**
+     * @brief Check that a payload's encoded frame fits the free space.
+     *
+     * @param payload Payload bytes.
+     */
+    bool fits(std::span<const uint8_t> payload) const
+    {
+        return cobs_encode_size(payload) + 1 <= N - fill;
+    }
+
+    /**
+     * @brief Encode one payload and its delimiter into the buffer.
+     *
+     * @param payload Payload bytes.
+     */
+    void push(std::span<const uint8_t> payload)
+    {
+        if (!fits(payload)) {
+            ++lost; // Whole-buffer overflow, the frame can never fit
+            return;
+        }
+        auto write = [&] (const uint8_t* p, size_t len) {
+            std::memcpy(buf + fill, p, len);
+            fill += len;
+        };
+        encoder.sink(payload, write);
+        encoder.stop(write);
+    }
+
+    cobs_encoder_t<> encoder = {};
+    std::coroutine_handle<> waiter = {};
+    size_t fill = 0;
+    size_t lost = 0;
+    uint8_t buf[N] = {};
+};
+
+}
+
+#endif
@@ -0,0 +1,220 @@
+/*
+ *   Copyright (C) 2025 Ilya Makarov <ilya.makarov.592@gmail.com> (@nth-eye).
+ *   All rights reserved.
+ */
+
+#ifndef NTH_COBS_FILE_H
+#define NTH_COBS_FILE_H
+
+#include <nth/cobs.h>
+
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "cobs_file.h requires a POSIX system with mmap"
+#endif
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <vector>
+
+namespace nth {
+
+namespace impl {
+
+/**
+ * @brief RAII file mapping used by the file-level codec drivers.
+ *
+ * Read mappings are advised `MADV_SEQUENTIAL`, matching the linear
+ * delimiter scan and block walk of the codec.
+ */
+struct cobs_mmap_t {
+
+    cobs_mmap_t() = default;
+    cobs_mmap_t(const cobs_mmap_t&) = delete;
+    cobs_mmap_t& operator=(const cobs_mmap_t&) = delete;
+
+    ~cobs_mmap_t()
+    {
+        if (data)
+            ::munmap(data, size);
+        if (fd >= 0)
+            ::close(fd);
+    }
+
+    bool open_read(const char* path)
+    {
+        fd = ::open(path, O_RDONLY);
+        if (fd < 0)
+            return false;
+        struct stat st;
+        if (::fstat(fd, &st) < 0)
+            return false;
+        size = size_t(st.st_size);
+        if (!size)
+            return true; // Empty file maps to nothing
+        void* p = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED)
+            return false;
+        ::madvise(p, size, MADV_SEQUENTIAL);
+        data = static_cast<uint8_t*>(p);
+        return true;
+    }
+
+    bool open_write(const char* path, size_t n)
+    {
+        fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0 || ::ftruncate(fd, off_t(n)) < 0)
+            return false;
+        size = n;
+        if (!n)
+            return true;
+        void* p = ::mmap(nullptr, n, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (p == MAP_FAILED)
+            return false;
+        data = static_cast<uint8_t*>(p);
+        return true;
+    }
+
+    std::span<const uint8_t> view() const
+    {
+        return { data, size };
+    }
+
+    uint8_t* data = nullptr;
+    size_t size = 0;
+    int fd = -1;
+};
+
+}
+
+/**
+ * @brief Decode a COBS capture file, yielding one decoded frame at a time.
+ *
+ * Memory-maps the file with sequential prefetch advice and walks it on
+ * `0x00` delimiters, so gigabyte captures stream through the page cache
+ * once instead of being double-buffered through read() calls. Every
+ * frame is checked with `cobs_validate` and decoded with the unchecked
+ * bulk path into a reused scratch buffer handed to the callback (size
+ * may be zero for empty frames). Consecutive delimiters are skipped as
+ * inter-frame padding.
+ *
+ * @param path Input capture file of delimited frames.
+ * @param cb Callable to handle one decoded frame at a time.
+ * @return Total decoded size and frame count, see `cobs_batch_t`;
+ *         `{ 0, index }` for a malformed frame, `{ 0, SIZE_MAX }` for a file error.
+ */
+inline cobs_batch_t cobs_decode_file(const char* path, CobsFrameCb auto&& cb)
+{
+    impl::cobs_mmap_t in;
+    if (!in.open_read(path))
+        return { 0, size_t(-1) };
+
+    std::vector<uint8_t> scratch;
+    size_t total = 0;
+    size_t idx = 0;
+
+    for (size_t off = 0; off < in.size;) {
+        size_t len = impl::cobs_scan_zero(in.data + off, in.size - off);
+        if (len) {
+            auto frame = in.view().subspan(off, len);
+            size_t size = cobs_validate(frame);
+            if (!size && !(len == 1 && frame[0] == 0x01))
+                return { 0, idx }; // Malformed frame, report its index
+            if (scratch.size() < size)
+                scratch.resize(size);
+            cobs_decode_unchecked(frame, scratch.data());
+            std::invoke(cb, scratch.data(), size);
+            total += size;
+            ++idx;
+        }
+        off += len + 1;
+    }
+    return { total, idx };
+}
+
+/**
+ * @brief Decode a COBS capture file into a packed output file.
+ *
+ * Maps the input sequentially, sizes every frame exactly with a
+ * `cobs_validate` pass, creates the output file at the exact total size
+ * and decodes each frame with the unchecked bulk path straight into the
+ * output mapping — no user-space staging buffer on either side.
+ *
+ * @param in_path Input capture file of delimited frames.
+ * @param out_path Output file receiving the packed decoded payloads.
+ * @param offsets Optional per-frame offsets of each decoded payload within the output.
+ * @return Total decoded size and frame count, see `cobs_batch_t`;
+ *         `{ 0, index }` for a malformed frame, `{ 0, SIZE_MAX }` for a file error.
+ */
+inline cobs_batch_t cobs_decode_file(const char* in_path, const char* out_path, std::span<size_t> offsets = {})
+{
+    impl::cobs_mmap_t in;
+    if (!in.open_read(in_path))
+        return { 0, size_t(-1) };
+
+    struct frame_t {
+        size_t off;
+        size_t len;
+        size_t size;
+    };
+    std::vector<frame_t> frames;
+    size_t total = 0;
+
+    for (size_t off = 0; off < in.size;) {
+        size_t len = impl::cobs_scan_zero(in.data + off, in.size - off);
+        if (len) {
+            auto frame = in.view().subspan(off, len);
+            size_t size = cobs_validate(frame);
+            if (!size && !(len == 1 && frame[0] == 0x01))
+                return { 0, frames.size() }; // Malformed frame, report its index
+            frames.push_back({ off, len, size });
+            total += size;
+        }
+        off += len + 1;
+    }
+    impl::cobs_mmap_t out;
+    if (!out.open_write(out_path, total))
+        return { 0, size_t(-1) };
+
+    size_t pos = 0;
+    for (size_t i = 0; i < frames.size(); ++i) {
+        if (i < offsets.size())
+            offsets[i] = pos;
+        cobs_decode_unchecked(in.view().subspan(frames[i].off, frames[i].len), out.data + pos);
+        pos += frames[i].size;
+    }
+    return { total, frames.size() };
+}
+
+/**
+ * @brief Encode a payload file into a delimited COBS frame file.
+ *
+ * Maps the payload sequentially, sizes the output exactly with the
+ * write-free scan, creates the output file at that size and encodes
+ * with the fast kernel straight into the output mapping, delimiter
+ * included.
+ *
+ * @param in_path Input payload file, encoded as one frame.
+ * @param out_path Output file receiving the encoded delimited frame.
+ * @return Total encoded size including the delimiter, 0 for a file error.
+ */
+inline size_t cobs_encode_file(const char* in_path, const char* out_path)
+{
+    impl::cobs_mmap_t in;
+    if (!in.open_read(in_path))
+        return 0;
+
+    size_t total = cobs_encode_size(in.view()) + 1;
+    impl::cobs_mmap_t out;
+    if (!out.open_write(out_path, total))
+        return 0;
+
+    cobs_encode(in.view(), std::span<uint8_t>{ out.data, out.size });
+    out.data[total - 1] = 0;
+    return total;
+}
+
+}
+
+#endif
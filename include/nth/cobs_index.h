@@ -0,0 +1,234 @@
+/*
+ *   Copyright (C) 2025 Ilya Makarov <ilya.makarov.592@gmail.com> (@nth-eye).
+ *   All rights reserved.
+ */
+
+#ifndef NTH_COBS_INDEX_H
+#define NTH_COBS_INDEX_H
+
+#include <nth/cobs.h>
+#include <vector>
+
+namespace nth {
+
+namespace impl {
+
+constexpr void cobs_index_put32(uint8_t* p, uint32_t v)
+{
+    p[0] = uint8_t(v >>  0);
+    p[1] = uint8_t(v >>  8);
+    p[2] = uint8_t(v >> 16);
+    p[3] = uint8_t(v >> 24);
+}
+
+constexpr void cobs_index_put64(uint8_t* p, uint64_t v)
+{
+    cobs_index_put32(p, uint32_t(v));
+    cobs_index_put32(p + 4, uint32_t(v >> 32));
+}
+
+constexpr uint32_t cobs_index_get32(const uint8_t* p)
+{
+    return uint32_t(p[0]) |
+          (uint32_t(p[1]) <<  8) |
+          (uint32_t(p[2]) << 16) |
+          (uint32_t(p[3]) << 24);
+}
+
+constexpr uint64_t cobs_index_get64(const uint8_t* p)
+{
+    return uint64_t(cobs_index_get32(p)) | (uint64_t(cobs_index_get32(p + 4)) << 32);
+}
+
+}
+
+/**
+ * @brief Sidecar index writer for random access into framed archives.
+ *
+ * Accumulates the archive byte offset of every frame during
+ * `cobs_encode`-based archival and serializes a compact sidecar: a
+ * little-endian header, one 64-bit base offset per group of frames and
+ * one delta-encoded 32-bit offset per frame relative to its group
+ * base. Lookup through `cobs_index_view_t` is O(1) while the per-frame
+ * cost stays at 4 bytes; a group's frames may span up to 4 GiB.
+ *
+ * Sidecar layout, all little-endian:
+ * `u32 magic, u32 group, u64 count, u64 base[ceil(count / group)], u32 rel[count]`.
+ */
+struct cobs_index_writer_t {
+
+    static constexpr uint32_t magic = 0x49424f43; // "COBI"
+    static constexpr uint32_t group = 1024;       // Frames per base entry
+
+    /**
+     * @brief Record the next frame, in archive order.
+     *
+     * @param offset Byte offset of the frame's first byte in the archive.
+     */
+    constexpr void add(uint64_t offset)
+    {
+        offsets.push_back(offset);
+    }
+
+    /**
+     * @brief Number of frames recorded so far.
+     *
+     */
+    constexpr size_t frames() const
+    {
+        return offsets.size();
+    }
+
+    /**
+     * @brief Exact serialized sidecar size in bytes.
+     *
+     */
+    constexpr size_t size() const
+    {
+        return 16 + ((offsets.size() + group - 1) / group) * 8 + offsets.size() * 4;
+    }
+
+    /**
+     * @brief Serialize the sidecar index into a buffer.
+     *
+     * Writes only when the whole sidecar fits; the required size is
+     * returned either way, so an undersized buffer can be resized and
+     * the call retried.
+     *
+     * @param out Output buffer for the sidecar bytes.
+     * @return Required sidecar size, 0 if a group spans 4 GiB or more.
+     */
+    constexpr size_t write(std::span<uint8_t> out) const
+    {
+        size_t total = size();
+        size_t bases = (offsets.size() + group - 1) / group;
+        for (size_t i = 0; i < offsets.size(); ++i) {
+            if (offsets[i] - offsets[i - i % group] > 0xffffffffull)
+                return 0; // Group span exceeds the 32-bit delta
+        }
+        if (out.size() < total)
+            return total;
+        uint8_t* p = out.data();
+        impl::cobs_index_put32(p, magic);
+        impl::cobs_index_put32(p + 4, group);
+        impl::cobs_index_put64(p + 8, offsets.size());
+        p += 16;
+        for (size_t i = 0; i < bases; ++i, p += 8)
+            impl::cobs_index_put64(p, offsets[i * group]);
+        for (size_t i = 0; i < offsets.size(); ++i, p += 4)
+            impl::cobs_index_put32(p, uint32_t(offsets[i] - offsets[i - i % group]));
+        return total;
+    }
+
+protected:
+
+    std::vector<uint64_t> offsets;
+};
+
+/**
+ * @brief Read-only view over a serialized sidecar index.
+ *
+ * Non-owning: wraps the sidecar bytes wherever they live, typically a
+ * memory mapping of the index file next to the archive. Locating any
+ * frame is O(1) — one base plus one delta load — turning full-archive
+ * delimiter scans into single-frame reads.
+ */
+struct cobs_index_view_t {
+
+    /**
+     * @brief Wrap serialized sidecar bytes, validating the layout.
+     *
+     * @param index Sidecar bytes, referenced for the view's lifetime.
+     */
+    constexpr cobs_index_view_t(std::span<const uint8_t> index)
+    {
+        if (index.size() < 16 ||
+            impl::cobs_index_get32(index.data()) != cobs_index_writer_t::magic)
+            return;
+        uint32_t g = impl::cobs_index_get32(index.data() + 4);
+        uint64_t n = impl::cobs_index_get64(index.data() + 8);
+        if (!g || index.size() != 16 + ((n + g - 1) / g) * 8 + n * 4)
+            return;
+        raw = index;
+        grp = g;
+        cnt = size_t(n);
+    }
+
+    /**
+     * @brief Whether the sidecar passed validation.
+     *
+     */
+    constexpr bool valid() const
+    {
+        return !raw.empty();
+    }
+
+    /**
+     * @brief Number of indexed frames.
+     *
+     */
+    constexpr size_t frames() const
+    {
+        return cnt;
+    }
+
+    /**
+     * @brief Archive byte offset of one frame, O(1).
+     *
+     * @param i Frame index, must be below `frames()`.
+     */
+    constexpr uint64_t offset(size_t i) const
+    {
+        const uint8_t* bases = raw.data() + 16;
+        const uint8_t* rels = bases + ((cnt + grp - 1) / grp) * 8;
+        return impl::cobs_index_get64(bases + (i / grp) * 8) +
+               impl::cobs_index_get32(rels + i * 4);
+    }
+
+    /**
+     * @brief Encoded bytes of one frame within the archive, O(1).
+     *
+     * @param archive The delimited archive the sidecar was built for.
+     * @param i Frame index.
+     * @return Encoded frame span, delimiter excluded; empty if `i` is
+     *         out of range or the sidecar disagrees with the archive.
+     */
+    constexpr std::span<const uint8_t> frame(std::span<const uint8_t> archive, size_t i) const
+    {
+        if (i >= cnt)
+            return {};
+        uint64_t off = offset(i);
+        uint64_t end = i + 1 < cnt ? offset(i + 1) : archive.size();
+        if (off >= end || end > archive.size())
+            return {};
+        if (archive[size_t(end) - 1] == 0x00)
+            --end; // Exclude the delimiter
+        return archive.subspan(size_t(off), size_t(end - off));
+    }
+
+    /**
+     * @brief Decode one frame straight out of the archive.
+     *
+     * Single-frame random access: the sidecar locates the frame in
+     * O(1) and the `cobs_decode` span overload decodes just its bytes.
+     *
+     * @param archive The delimited archive the sidecar was built for.
+     * @param i Frame index.
+     * @param out Output buffer.
+     * @return Required number of decoded bytes, 0 if out of range or malformed.
+     */
+    constexpr size_t decode(std::span<const uint8_t> archive, size_t i, std::span<uint8_t> out) const
+    {
+        return cobs_decode(frame(archive, i), out);
+    }
+
+protected:
+
+    std::span<const uint8_t> raw = {};
+    uint32_t grp = 0;
+    size_t cnt = 0;
+};
+
+}
+
+#endif
@@ -0,0 +1,163 @@
+/*
+ *   Copyright (C) 2025 Ilya Makarov <ilya.makarov.592@gmail.com> (@nth-eye).
+ *   All rights reserved.
+ */
+
+#ifndef NTH_COBS_PARALLEL_H
+#define NTH_COBS_PARALLEL_H
+
+#include <nth/cobs.h>
+#include <thread>
+#include <vector>
+
+namespace nth {
+
+namespace impl {
+
+/**
+ * @brief Run `fn(begin, end)` over `[0, n)` split across threads.
+ *
+ * The calling thread works on the first chunk, extra threads are
+ * spawned only for the remaining ones.
+ *
+ * @param n Number of items.
+ * @param n_threads Number of workers to split across.
+ * @param fn Callable invoked with a disjoint `[begin, end)` item range.
+ */
+template<class F>
+inline void cobs_parallel_for(size_t n, size_t n_threads, F&& fn)
+{
+    if (!n)
+        return;
+    if (n_threads < 2 || n < 2) {
+        fn(size_t(0), n);
+        return;
+    }
+    size_t chunk = (n + n_threads - 1) / n_threads;
+    std::vector<std::thread> pool;
+    pool.reserve(n_threads - 1);
+    for (size_t begin = chunk; begin < n; begin += chunk) {
+        size_t end = begin + chunk < n ? begin + chunk : n;
+        pool.emplace_back([&fn, begin, end] { fn(begin, end); });
+    }
+    fn(size_t(0), chunk < n ? chunk : n);
+    for (auto& t : pool)
+        t.join();
+}
+
+}
+
+/**
+ * @brief Decode a stream of concatenated delimited frames across threads.
+ *
+ * Frames are independent after each `0x00` delimiter, so the input is
+ * split on delimiters, decoded sizes are computed in parallel with a
+ * write-free sizing pass, and after a serial prefix sum every frame is
+ * decoded into its precomputed output offset in parallel. Results are
+ * identical to `cobs_decode_batch`, including the write-what-fits
+ * behavior for an undersized output buffer.
+ *
+ * @param in Input stream of delimited frames.
+ * @param out Output buffer for the packed decoded payloads.
+ * @param n_threads Number of worker threads, 0 for hardware concurrency.
+ * @param offsets Optional per-frame offsets of each decoded payload within `out`.
+ * @return Required total size and frame count, see `cobs_batch_t`.
+ */
+inline cobs_batch_t cobs_decode_parallel(std::span<const uint8_t> in, std::span<uint8_t> out, size_t n_threads = 0, std::span<size_t> offsets = {})
+{
+    if (!n_threads)
+        n_threads = std::thread::hardware_concurrency();
+    if (!n_threads)
+        n_threads = 1;
+
+    struct frame_t {
+        size_t off;     // Offset of the encoded frame within the input
+        size_t len;     // Encoded length without delimiter
+        size_t dst;     // Offset of the decoded payload within the output
+        size_t size;    // Decoded size, -1 if malformed
+    };
+    std::vector<frame_t> frames;
+
+    for (size_t off = 0; off < in.size();) {
+        size_t len = impl::cobs_scan_zero(in.data() + off, in.size() - off);
+        if (len)
+            frames.push_back({ off, len, 0, 0 });
+        off += len + 1;
+    }
+    impl::cobs_parallel_for(frames.size(), n_threads, [&] (size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            auto frame = in.subspan(frames[i].off, frames[i].len);
+            size_t size = cobs_decode(frame, std::span<uint8_t>{});
+            if (!size && !(frame.size() == 1 && frame[0] == 0x01))
+                size = size_t(-1);
+            frames[i].size = size;
+        }
+    });
+    size_t pos = 0;
+    for (size_t i = 0; i < frames.size(); ++i) {
+        if (frames[i].size == size_t(-1))
+            return { 0, i }; // Malformed frame, report its index
+        if (i < offsets.size())
+            offsets[i] = pos;
+        frames[i].dst = pos;
+        pos += frames[i].size;
+    }
+    impl::cobs_parallel_for(frames.size(), n_threads, [&] (size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            auto slice = frames[i].dst < out.size() ? out.subspan(frames[i].dst) : std::span<uint8_t>{};
+            cobs_decode(in.subspan(frames[i].off, frames[i].len), slice);
+        }
+    });
+    return { pos, frames.size() };
+}
+
+/**
+ * @brief Encode multiple frames into one packed delimited stream across threads.
+ *
+ * Frame boundaries are supplied by the caller, so each frame encodes
+ * independently: a parallel write-free sizing pass, a serial prefix sum
+ * of output offsets, then a parallel encode of every frame (plus its
+ * `0x00` delimiter) into its slot. Output is identical to
+ * `cobs_encode_batch`, including the write-what-fits behavior.
+ *
+ * @param frames Input frames to encode.
+ * @param out Output buffer for the packed delimited stream.
+ * @param n_threads Number of worker threads, 0 for hardware concurrency.
+ * @param offsets Optional per-frame offsets of each encoded frame within `out`.
+ * @return Required total number of encoded bytes including delimiters.
+ */
+inline size_t cobs_encode_parallel(std::span<const std::span<const uint8_t>> frames, std::span<uint8_t> out, size_t n_threads = 0, std::span<size_t> offsets = {})
+{
+    if (!n_threads)
+        n_threads = std::thread::hardware_concurrency();
+    if (!n_threads)
+        n_threads = 1;
+
+    std::vector<size_t> dst(frames.size());
+
+    impl::cobs_parallel_for(frames.size(), n_threads, [&] (size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+            dst[i] = cobs_encode(frames[i], std::span<uint8_t>{});
+    });
+    size_t pos = 0;
+    for (size_t i = 0; i < frames.size(); ++i) {
+        size_t size = dst[i];
+        if (i < offsets.size())
+            offsets[i] = pos;
+        dst[i] = pos;
+        pos += size + 1;
+    }
+    impl::cobs_parallel_for(frames.size(), n_threads, [&] (size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            auto slice = dst[i] < out.size() ? out.subspan(dst[i]) : std::span<uint8_t>{};
+            size_t size = cobs_encode(frames[i], slice);
+            if (dst[i] + size < out.size())
+                out[dst[i] + size] = 0;
+        }
+    });
+    return pos;
+}
+
+}
+
+#endif
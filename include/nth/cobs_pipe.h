@@ -0,0 +1,152 @@
+/*
+ *   Copyright (C) 2025 Ilya Makarov <ilya.makarov.592@gmail.com> (@nth-eye).
+ *   All rights reserved.
+ */
+
+#ifndef NTH_COBS_PIPE_H
+#define NTH_COBS_PIPE_H
+
+#include <nth/cobs.h>
+#include <atomic>
+
+namespace nth {
+
+/**
+ * @brief Lock-free single-producer/single-consumer framing pipe.
+ *
+ * Bridges an ISR or thread producing payloads and a consumer decoding
+ * them, e.g. the usual MCU deployment of this library, without a lock:
+ * one release store publishes each frame and one acquire load observes
+ * it. The producer encodes with `cobs_encoder_t` directly into the ring
+ * storage and appends the `0x00` delimiter; the consumer hands the
+ * contiguous readable regions (at most two per drain, split at the
+ * wrap) straight to `cobs_decoder_t::sink`, so no intermediate staging
+ * buffer exists on either side. Producer state, consumer state and the
+ * two shared cursors live on separate cache lines to avoid false
+ * sharing. Exactly one producer thread may call `send()`/`writable()`
+ * and exactly one consumer thread may call `recv()`/`readable()`.
+ *
+ * @tparam N Ring capacity in bytes, must be a power of two.
+ */
+template<size_t N>
+struct cobs_pipe_t {
+
+    static_assert(N && !(N & (N - 1)), "ring capacity must be a power of two");
+
+    /**
+     * @brief Reset internal state. NOT thread-safe, both sides must be idle.
+     *
+     */
+    void reset()
+    {
+        encoder.reset();
+        decoder.reset();
+        head_seen = 0;
+        tail_seen = 0;
+        head.store(0, std::memory_order_relaxed);
+        tail.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Number of free ring bytes, producer side only.
+     *
+     */
+    size_t writable() const
+    {
+        return N - (tail.load(std::memory_order_relaxed) - head.load(std::memory_order_acquire));
+    }
+
+    /**
+     * @brief Number of pending encoded bytes, consumer side only.
+     *
+     */
+    size_t readable() const
+    {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Encode one payload into the ring as a delimited frame.
+     *
+     * All-or-nothing: the exact encoded size is computed with a
+     * write-free scan first, and if it does not fit nothing is written,
+     * so a rejected frame never corrupts the stream. The frame becomes
+     * visible to the consumer with a single release store after all its
+     * bytes are in place.
+     *
+     * @param payload Payload bytes to encode.
+     * @return true if the frame was enqueued, false if the ring is too full.
+     */
+    NTH_COBS_NOINLINE_ATTR bool send(std::span<const uint8_t> payload)
+    {
+        size_t need = cobs_encode_size(payload) + 1;
+        size_t w = tail.load(std::memory_order_relaxed);
+
+        if (N - (w - head_seen) < need) {
+            head_seen = head.load(std::memory_order_acquire);
+            if (N - (w - head_seen) < need)
+                return false;
+        }
+        auto write = [&] (const uint8_t* p, size_t len) {
+            while (len) {
+                size_t off = w & (N - 1);
+                size_t fit = N - off < len ? N - off : len;
+                std::memcpy(buf + off, p, fit);
+                w += fit;
+                p += fit;
+                len -= fit;
+            }
+        };
+        encoder.sink(payload, write);
+        encoder.stop(write);
+        tail.store(w, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Drain pending bytes through the consumer-side decoder.
+     *
+     * Feeds every contiguous readable region to `cobs_decoder_t::sink`,
+     * which invokes the callback per decoded chunk and per completed
+     * frame, then retires the bytes with a single release store. A frame
+     * published only partially so far decodes partially and resumes on
+     * the next call, as usual for the streaming decoder.
+     *
+     * @param cb Callable to handle decoded chunk when ready.
+     * @return Number of encoded bytes consumed, 0 if the ring was empty.
+     */
+    NTH_COBS_NOINLINE_ATTR size_t recv(CobsDecodeCb auto&& cb)
+    {
+        size_t r = head.load(std::memory_order_relaxed);
+        size_t w = tail_seen;
+
+        if (r == w) {
+            tail_seen = w = tail.load(std::memory_order_acquire);
+            if (r == w)
+                return 0;
+        }
+        size_t total = w - r;
+        while (r != w) {
+            size_t off = r & (N - 1);
+            size_t len = w - r < N - off ? w - r : N - off;
+            decoder.sink({buf + off, len}, cb);
+            r += len;
+        }
+        head.store(r, std::memory_order_release);
+        return total;
+    }
+
+protected:
+
+    alignas(64) cobs_encoder_t<> encoder = {};  // Producer-owned line
+    size_t head_seen = 0;
+    alignas(64) cobs_decoder_t<> decoder = {};  // Consumer-owned line
+    size_t tail_seen = 0;
+    alignas(64) std::atomic<size_t> head = 0;   // Shared cursors, a line each
+    alignas(64) std::atomic<size_t> tail = 0;
+    alignas(64) uint8_t buf[N] = {};
+};
+
+}
+
+#endif
@@ -0,0 +1,267 @@
+/*
+ *   Copyright (C) 2025 Ilya Makarov <ilya.makarov.592@gmail.com> (@nth-eye).
+ *   All rights reserved.
+ */
+
+#ifndef NTH_COBS_POOL_H
+#define NTH_COBS_POOL_H
+
+#include <nth/cobs.h>
+#include <condition_variable>
+#include <unordered_map>
+#include <thread>
+#include <deque>
+#include <mutex>
+#include <map>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace nth {
+
+/**
+ * @brief Concept of a completion callable for `cobs_codec_pool_t`.
+ *
+ * Mirrors `CobsDecodeCb` with a leading connection id: invoked with the
+ * decoded payload and `left == 0`, or with `left != 0` for a malformed
+ * frame.
+ */
+template<class W>
+concept CobsPoolCb = std::is_invocable_r_v<void, W&, size_t, const uint8_t*, size_t, size_t>;
+
+/**
+ * @brief Work-stealing decode pool with per-connection ordered completions.
+ *
+ * Replaces the one-decoder-per-connection-thread layout whose throughput
+ * is bound by the busiest core: encoded frames from any number of
+ * producer threads are submitted to per-worker deques (round-robin, so
+ * a fat connection spreads over the machine), and an idle worker steals
+ * from the back of its neighbours' deques before sleeping. Each frame
+ * decodes independently with the `cobs_decode` span overload; a
+ * per-connection sequence number and reorder buffer deliver completions
+ * in submission order, serialized per connection, while different
+ * connections complete concurrently on different workers.
+ *
+ * Frame bytes are copied at `submit()`, so scanner spans may be reused
+ * immediately. The destructor drains all submitted work before joining.
+ *
+ * @tparam Cb Completion callable type, see `CobsPoolCb`.
+ */
+template<CobsPoolCb Cb>
+struct cobs_codec_pool_t {
+
+    /**
+     * @brief Construct the pool and start its workers.
+     *
+     * @param cb Completion callable, invoked on worker threads.
+     * @param n_threads Number of worker threads, 0 for hardware concurrency.
+     */
+    cobs_codec_pool_t(Cb cb, size_t n_threads = 0) : cb(std::move(cb))
+    {
+        if (!n_threads)
+            n_threads = std::thread::hardware_concurrency();
+        if (!n_threads)
+            n_threads = 1;
+        n_workers = n_threads;
+        queues = std::make_unique<queue_t[]>(n_threads);
+        workers.reserve(n_threads);
+        for (size_t i = 0; i < n_threads; ++i)
+            workers.emplace_back([this, i] { work(i); });
+    }
+
+    ~cobs_codec_pool_t()
+    {
+        {
+            std::lock_guard lk{sleep_mx};
+            quit = true;
+        }
+        cv.notify_all();
+        for (auto& t : workers)
+            t.join();
+    }
+
+    /**
+     * @brief Submit one encoded frame for decoding, any producer thread.
+     *
+     * @param conn Connection id ordering this frame's completion.
+     * @param frame Encoded frame bytes, delimiter optional, copied.
+     */
+    void submit(size_t conn, std::span<const uint8_t> frame)
+    {
+        item_t it;
+        it.enc.assign(frame.begin(), frame.end());
+        it.conn = conn;
+        it.seq = state(conn).next_seq.fetch_add(1, std::memory_order_relaxed);
+        {
+            // Count the item before publishing it: a worker may pop and
+            // decrement the moment it lands in the deque, and pending must
+            // not underflow or flush() can miss its wakeup.
+            std::lock_guard lk{sleep_mx};
+            ++pending;
+        }
+        {
+            auto& q = queues[rr.fetch_add(1, std::memory_order_relaxed) % n_workers];
+            std::lock_guard lk{q.mx};
+            q.items.push_back(std::move(it));
+        }
+        cv.notify_one();
+    }
+
+    /**
+     * @brief Block until every submitted frame has completed.
+     *
+     */
+    void flush()
+    {
+        std::unique_lock lk{sleep_mx};
+        done_cv.wait(lk, [&] { return !pending && !inflight; });
+    }
+
+protected:
+
+    struct item_t {
+        std::vector<uint8_t> enc;   // Encoded frame, owned copy
+        size_t conn = 0;
+        size_t seq = 0;
+    };
+
+    struct done_t {
+        std::vector<uint8_t> dec;   // Decoded payload
+        size_t size = 0;
+        size_t left = 0;            // Nonzero for a malformed frame
+    };
+
+    struct queue_t {
+        std::mutex mx;
+        std::deque<item_t> items;
+    };
+
+    struct conn_t {
+        std::atomic<size_t> next_seq = 0;
+        std::mutex mx;
+        std::map<size_t, done_t> reorder;
+        size_t next_done = 0;
+    };
+
+    /**
+     * @brief Per-connection ordering state, created on first use.
+     *
+     * @param conn Connection id.
+     */
+    conn_t& state(size_t conn)
+    {
+        std::lock_guard lk{conns_mx};
+        auto& slot = conns[conn];
+        if (!slot)
+            slot = std::make_unique<conn_t>();
+        return *slot;
+    }
+
+    /**
+     * @brief Pop from the own deque's front or steal from a neighbour's back.
+     *
+     * @param id Worker index.
+     * @param it Receives the taken item.
+     */
+    bool take(size_t id, item_t& it)
+    {
+        for (size_t i = 0; i < n_workers; ++i) {
+            auto& q = queues[(id + i) % n_workers];
+            std::lock_guard lk{q.mx};
+            if (q.items.empty())
+                continue;
+            if (i) {
+                it = std::move(q.items.back()); // Steal the coldest item
+                q.items.pop_back();
+            } else {
+                it = std::move(q.items.front());
+                q.items.pop_front();
+            }
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Decode one item and release its completion in order.
+     *
+     * @param it Taken work item.
+     */
+    void run(item_t& it)
+    {
+        auto enc = std::span<const uint8_t>{it.enc};
+        if (!enc.empty() && enc.back() == 0x00)
+            enc = enc.first(enc.size() - 1); // Strip the optional delimiter
+
+        done_t d;
+        d.dec.resize(cobs_decode_max_size(it.enc.size()));
+        d.size = cobs_decode(enc, std::span<uint8_t>{d.dec});
+        if (!d.size && !(enc.size() == 1 && enc[0] == 0x01))
+            d.left = 1; // Malformed frame
+
+        auto& c = state(it.conn);
+        std::lock_guard lk{c.mx};
+        c.reorder.emplace(it.seq, std::move(d));
+        // Drain every consecutive completion that is now ready, in order
+        for (auto n = c.reorder.find(c.next_done); n != c.reorder.end();
+                  n = c.reorder.find(++c.next_done)) {
+            auto& r = n->second;
+            std::invoke(cb, it.conn, r.dec.data(), r.size, r.left);
+            c.reorder.erase(n);
+        }
+    }
+
+    /**
+     * @brief Worker loop: drain, steal, then sleep until new work or shutdown.
+     *
+     * @param id Worker index.
+     */
+    void work(size_t id)
+    {
+        while (true) {
+            item_t it;
+            if (take(id, it)) {
+                {
+                    std::lock_guard lk{sleep_mx};
+                    --pending;
+                    ++inflight;
+                }
+                run(it);
+                bool idle;
+                {
+                    std::lock_guard lk{sleep_mx};
+                    idle = !--inflight && !pending;
+                }
+                if (idle)
+                    done_cv.notify_all();
+                continue;
+            }
+            std::unique_lock lk{sleep_mx};
+            if (!pending) {
+                if (quit)
+                    return;
+                cv.wait(lk, [&] { return quit || pending; });
+                if (quit && !pending)
+                    return;
+            }
+        }
+    }
+
+    Cb cb;
+    size_t n_workers = 0;
+    std::unique_ptr<queue_t[]> queues;
+    std::vector<std::thread> workers;
+    std::mutex conns_mx;
+    std::unordered_map<size_t, std::unique_ptr<conn_t>> conns;
+    std::mutex sleep_mx;
+    std::condition_variable cv;
+    std::condition_variable done_cv;
+    size_t pending = 0;     // Queued items, guarded by sleep_mx
+    size_t inflight = 0;    // Taken but not completed items, guarded by sleep_mx
+    std::atomic<size_t> rr = 0;
+    bool quit = false;      // Guarded by sleep_mx
+};
+
+}
+
+#endif
@@ -179,6 +179,7 @@ static constexpr test_result_t run()
             base_encoding_callback(buf, len);
     };
     cobs_decoder_t decoder;
+    cobs_decoder_view_t viewer;
     cobs_encoder_t encoder;
 
     auto encode_streamer = [&] (test_pair_t pair) {
@@ -197,6 +198,18 @@ static constexpr test_result_t run()
             context.data[context.size++] = 0;
         }
     };
+    auto encode_buffer_sparse = [&] (test_pair_t pair) {
+        context.size = cobs_encode<cobs_hint::sparse_zeros>(pair.decoded, context.data);
+        if (context.size == pair.encoded.size() - 1) {
+            context.data[context.size++] = 0;
+        }
+    };
+    auto encode_buffer_dense = [&] (test_pair_t pair) {
+        context.size = cobs_encode<cobs_hint::dense_zeros>(pair.decoded, context.data);
+        if (context.size == pair.encoded.size() - 1) {
+            context.data[context.size++] = 0;
+        }
+    };
 
     auto decode_streamer = [&] (test_pair_t pair) {
         decoder.sink(pair.encoded, base_decoding_callback);
@@ -207,6 +220,11 @@ static constexpr test_result_t run()
     auto decode_buffer = [&] (test_pair_t pair) {
         context.size = cobs_decode(pair.encoded, context.data);
     };
+    auto decode_viewer = [&] (test_pair_t pair) {
+        std::span<const uint8_t> enc = { pair.encoded.begin(), pair.encoded.size() };
+        viewer.sink(enc.first(enc.size() / 2), base_decoding_callback);
+        viewer.sink(enc.subspan(enc.size() / 2), base_decoding_callback);
+    };
 
     auto enc_selector = [] (const test_pair_t& p) { return p.encoded; };
     auto dec_selector = [] (const test_pair_t& p) { return p.decoded; };
@@ -218,18 +236,605 @@ static constexpr test_result_t run()
     if (ret.status) return ret;
     ret = test_cases(context, 3, encode_buffer, enc_selector);
     if (ret.status) return ret;
+    ret = test_cases(context, 4, encode_buffer_sparse, enc_selector);
+    if (ret.status) return ret;
+    ret = test_cases(context, 5, encode_buffer_dense, enc_selector);
+    if (ret.status) return ret;
 
-    ret = test_cases(context, 4, decode_streamer, dec_selector);
+    ret = test_cases(context, 6, decode_streamer, dec_selector);
+    if (ret.status) return ret;
+    ret = test_cases(context, 7, decode_callback, dec_selector);
+    if (ret.status) return ret;
+    ret = test_cases(context, 8, decode_buffer, dec_selector);
     if (ret.status) return ret;
-    ret = test_cases(context, 5, decode_callback, dec_selector);
-    if (ret.status) return ret; 
-    ret = test_cases(context, 6, decode_buffer, dec_selector);
+    ret = test_cases(context, 9, decode_viewer, dec_selector);
     if (ret.status) return ret;
 
     return ret;
 }
+static constexpr bool run_batch()
+{
+    std::array<uint8_t, 4096> packed = {};
+    std::array<uint8_t, 4096> expect = {};
+    std::array<std::span<const uint8_t>, test_pairs.size()> frames = {};
+    std::array<size_t, test_pairs.size()> enc_offsets = {};
+    std::array<size_t, test_pairs.size()> dec_offsets = {};
+    size_t expect_size = 0;
+
+    for (size_t i = 0; i < test_pairs.size(); ++i) {
+        frames[i] = { test_pairs[i].decoded.begin(), test_pairs[i].decoded.size() };
+        for (auto b : test_pairs[i].encoded)
+            expect[expect_size++] = b;
+    }
+    size_t packed_size = cobs_encode_batch(frames, packed, enc_offsets);
+    if (packed_size != expect_size)
+        return false;
+    if (!std::equal(expect.begin(), expect.begin() + expect_size, packed.begin()))
+        return false;
+    size_t offset = 0;
+    for (size_t i = 0; i < test_pairs.size(); ++i) {
+        if (enc_offsets[i] != offset)
+            return false;
+        offset += test_pairs[i].encoded.size();
+    }
+    std::array<uint8_t, 4096> unpacked = {};
+    auto [unpacked_size, unpacked_frames] = cobs_decode_batch({packed.data(), packed_size}, unpacked, dec_offsets);
+    if (unpacked_frames != test_pairs.size())
+        return false;
+    offset = 0;
+    for (size_t i = 0; i < test_pairs.size(); ++i) {
+        if (dec_offsets[i] != offset)
+            return false;
+        if (!std::equal(test_pairs[i].decoded.begin(), test_pairs[i].decoded.end(), unpacked.begin() + offset))
+            return false;
+        offset += test_pairs[i].decoded.size();
+    }
+    return unpacked_size == offset;
+}
+
+static constexpr bool run_inplace()
+{
+    for (auto& pair : test_pairs) {
+        std::array<uint8_t, 512> buf = {};
+        size_t headroom = pair.encoded.size() - 1 - pair.decoded.size(); // Exact code byte count
+        std::copy(pair.decoded.begin(), pair.decoded.end(), buf.begin() + headroom);
+        size_t size = cobs_encode_inplace({buf.data(), headroom + pair.decoded.size()}, headroom);
+        if (size != pair.encoded.size() - 1)
+            return false;
+        if (!std::equal(buf.begin(), buf.begin() + size, pair.encoded.begin()))
+            return false;
+        std::copy(pair.encoded.begin(), pair.encoded.end(), buf.begin());
+        size = cobs_decode_inplace({buf.data(), pair.encoded.size()});
+        if (size != pair.decoded.size())
+            return false;
+        if (!std::equal(buf.begin(), buf.begin() + size, pair.decoded.begin()))
+            return false;
+    }
+    // 255 zero-free payload bytes need 2 bytes of headroom, 1 must be refused
+    std::array<uint8_t, 256> tight = {};
+    for (size_t i = 1; i < tight.size(); ++i)
+        tight[i] = uint8_t(i);
+    return cobs_encode_inplace(tight, 1) == 0;
+}
+
+static constexpr bool run_block_sizes()
+{
+    std::array<uint8_t, 512> enc = {};
+    std::array<uint8_t, 512> dec = {};
+    size_t enc_size = 0;
+    size_t dec_size = 0;
+    bool bad = false;
+
+    auto enc_cb = [&] (const uint8_t* buf, size_t len) {
+        for (size_t i = 0; i < len; ++i)
+            enc[enc_size++] = buf[i];
+    };
+    auto dec_cb = [&] (const uint8_t* buf, size_t len, size_t left) {
+        if (left) {
+            bad = true;
+            return;
+        }
+        for (size_t i = 0; i < len; ++i)
+            dec[dec_size++] = buf[i];
+    };
+    cobs_encoder_t<5> encoder;
+    cobs_decoder_t<5> decoder;
+
+    for (auto& pair : test_pairs) {
+        // Matched small-block encoder/decoder pair must round-trip
+        enc_size = dec_size = 0;
+        encoder.sink(pair.decoded, enc_cb);
+        encoder.stop(enc_cb);
+        decoder.sink({enc.data(), enc_size}, dec_cb);
+        if (bad || dec_size != pair.decoded.size())
+            return false;
+        if (!std::equal(pair.decoded.begin(), pair.decoded.end(), dec.begin()))
+            return false;
+    }
+    return true;
+}
+
+static constexpr bool run_sizes()
+{
+    for (auto& pair : test_pairs) {
+        size_t size = cobs_encode_size({pair.decoded.begin(), pair.decoded.size()});
+        if (size != pair.encoded.size() - 1)
+            return false;
+        if (size > cobs_encode_max_size(pair.decoded.size()))
+            return false;
+        if (cobs_decode_max_size(size) < pair.decoded.size())
+            return false;
+    }
+    // Zero-free payloads hit the worst case exactly
+    std::array<uint8_t, 1000> dense = {};
+    for (size_t i = 0; i < dense.size(); ++i)
+        dense[i] = uint8_t(i | 1);
+    for (size_t n : { size_t(0), size_t(1), size_t(253), size_t(254), size_t(255), size_t(508), size_t(509), dense.size() }) {
+        if (cobs_encode_size({dense.data(), n}) != cobs_encode_max_size(n))
+            return false;
+    }
+    return true;
+}
+
+static constexpr bool run_reduced()
+{
+    // Known COBS/R vectors: large final byte folds, small one does not
+    std::array<uint8_t, 8> enc = {};
+    const uint8_t big[] = { 0x2f };
+    const uint8_t small[] = { 0x01 };
+    if (cobs_r_encode({big, 1}, enc) != 1 || enc[0] != 0x2f)
+        return false;
+    if (cobs_r_encode({small, 1}, enc) != 2 || enc[0] != 0x02 || enc[1] != 0x01)
+        return false;
+
+    for (auto& pair : test_pairs) {
+        std::array<uint8_t, 512> renc = {};
+        std::array<uint8_t, 512> rdec = {};
+        std::span<const uint8_t> payload = { pair.decoded.begin(), pair.decoded.size() };
+        size_t enc_size = cobs_r_encode(payload, renc);
+        // Never longer than classic, shorter by at most one byte
+        if (enc_size > pair.encoded.size() - 1 || enc_size + 1 < pair.encoded.size() - 1)
+            return false;
+        if (cobs_r_decode({renc.data(), enc_size}, rdec) != payload.size())
+            return false;
+        if (!std::equal(payload.begin(), payload.end(), rdec.begin()))
+            return false;
+        // Classic frames must decode unchanged through the reduced decoder
+        if (cobs_r_decode({pair.encoded.begin(), pair.encoded.size()}, rdec) != payload.size())
+            return false;
+        if (!std::equal(payload.begin(), payload.end(), rdec.begin()))
+            return false;
+        // Streaming policy flag must match the one-shot variants
+        cobs_encoder_t<254, false, true> encoder;
+        cobs_decoder_t<254, false, true> decoder;
+        std::array<uint8_t, 512> senc = {};
+        std::array<uint8_t, 512> sdec = {};
+        size_t senc_size = 0;
+        size_t sdec_size = 0;
+        bool bad = false;
+        encoder.sink(payload, [&] (const uint8_t* p, size_t len) {
+            for (size_t i = 0; i < len; ++i)
+                senc[senc_size++] = p[i];
+        });
+        encoder.stop([&] (const uint8_t* p, size_t len) {
+            for (size_t i = 0; i < len; ++i)
+                senc[senc_size++] = p[i];
+        });
+        if (senc_size != enc_size + 1 || senc[senc_size - 1] != 0x00)
+            return false;
+        if (!std::equal(renc.begin(), renc.begin() + enc_size, senc.begin()))
+            return false;
+        decoder.sink({senc.data(), senc_size}, [&] (const uint8_t* p, size_t len, size_t left) {
+            if (left)
+                bad = true;
+            for (size_t i = 0; i < len; ++i)
+                sdec[sdec_size++] = p[i];
+        });
+        if (bad || sdec_size != payload.size())
+            return false;
+        if (!std::equal(payload.begin(), payload.end(), sdec.begin()))
+            return false;
+    }
+    return true;
+}
+
+static constexpr bool run_stats()
+{
+    // Disabled facet must cost no storage beyond the plain codec
+    static_assert(sizeof(cobs_encoder_t<254, false>) == sizeof(uint8_t[254 + 2]));
+    static_assert(sizeof(cobs_decoder_t<254, false>) == sizeof(uint8_t[254 + 1]) + 3);
+    static_assert(sizeof(cobs_encoder_t<254, true>) > sizeof(cobs_encoder_t<254, false>));
+    static_assert(sizeof(cobs_decoder_t<254, true>) > sizeof(cobs_decoder_t<254, false>));
+
+    cobs_encoder_t<254, true> encoder;
+    cobs_decoder_t<254, true> decoder;
+    std::array<uint8_t, 512> enc = {};
+    size_t enc_size = 0;
+
+    const uint8_t payload[] = { 0x01, 0x02, 0x00, 0x03 };
+    encoder.sink({payload, 4}, [&] (const uint8_t* p, size_t len) {
+        for (size_t i = 0; i < len; ++i)
+            enc[enc_size++] = p[i];
+    });
+    encoder.stop([&] (const uint8_t* p, size_t len) {
+        for (size_t i = 0; i < len; ++i)
+            enc[enc_size++] = p[i];
+    });
+    auto& es = encoder.stats();
+    if (es.bytes_in != 4 || es.bytes_out != 6 || es.frames != 1 || es.flushes != 1 || es.max_fill != 2)
+        return false;
+
+    size_t dec_size = 0;
+    size_t left_seen = 0;
+    auto dec_cb = [&] (const uint8_t*, size_t len, size_t left) {
+        dec_size += len;
+        left_seen += left;
+    };
+    decoder.sink({enc.data(), enc_size}, dec_cb);
+    const uint8_t truncated[] = { 0x05, 0x31 };
+    decoder.sink({truncated, 2}, dec_cb);
+    decoder.stop(dec_cb);
+    auto& ds = decoder.stats();
+    if (ds.bytes_in != 8 || ds.bytes_out != dec_size || ds.frames != 2 || ds.malformed != 1 || !left_seen)
+        return false;
+    decoder.reset();
+    return decoder.stats().frames == 0;
+}
+
+static constexpr bool run_validate()
+{
+    for (auto& pair : test_pairs) {
+        std::span<const uint8_t> enc = { pair.encoded.begin(), pair.encoded.size() };
+        // With and without the trailing delimiter
+        if (cobs_validate(enc) != pair.decoded.size())
+            return false;
+        if (cobs_validate(enc.first(enc.size() - 1)) != pair.decoded.size())
+            return false;
+        std::array<uint8_t, 512> dec = {};
+        if (cobs_decode_unchecked(enc, dec.data()) != pair.decoded.size())
+            return false;
+        if (!std::equal(pair.decoded.begin(), pair.decoded.end(), dec.begin()))
+            return false;
+        // Any truncation that splits a block must be rejected by both
+        for (size_t cut = 1; cut + 1 < enc.size(); ++cut) {
+            size_t a = cobs_validate(enc.first(cut));
+            size_t b = cobs_decode_unchecked(enc.first(cut), dec.data());
+            size_t c = cobs_decode(enc.first(cut), std::span<uint8_t>{dec});
+            if (a != c || b != c)
+                return false;
+        }
+    }
+    return true;
+}
+
+static constexpr bool run_static()
+{
+    constexpr auto keepalive = cobs_encode_static<0x11, 0x22, 0x00, 0x33>();
+    if (keepalive != std::array<uint8_t, 6>{ 0x03, 0x11, 0x22, 0x02, 0x33, 0x00 })
+        return false;
+    constexpr auto empty = cobs_encode_static<>();
+    if (empty != std::array<uint8_t, 2>{ 0x01, 0x00 })
+        return false;
+    constexpr auto beacon = [] {
+        std::array<uint8_t, 254> frame = {};
+        for (size_t i = 0; i < frame.size(); ++i)
+            frame[i] = uint8_t(1 + i % 255);
+        return frame;
+    }();
+    constexpr auto encoded = cobs_encode_static<beacon>();
+    if (encoded.size() != 256 || encoded.front() != 0xff || encoded.back() != 0x00)
+        return false;
+    std::array<uint8_t, 512> dec = {};
+    if (cobs_decode({encoded.data(), encoded.size()}, dec) != beacon.size())
+        return false;
+    return std::equal(beacon.begin(), beacon.end(), dec.begin());
+}
+
+static constexpr bool run_iterator()
+{
+    for (auto& pair : test_pairs) {
+        std::array<uint8_t, 512> enc = {};
+        std::array<uint8_t, 512> dec = {};
+        // Raw pointer as output iterator, straight-line loop with no callable
+        size_t enc_size = cobs_encode({pair.decoded.begin(), pair.decoded.size()}, enc.begin());
+        if (enc_size != pair.encoded.size() - 1)
+            return false;
+        if (!std::equal(enc.begin(), enc.begin() + enc_size, pair.encoded.begin()))
+            return false;
+        size_t dec_size = cobs_decode({pair.encoded.begin(), pair.encoded.size()}, dec.begin());
+        if (dec_size != pair.decoded.size())
+            return false;
+        if (!std::equal(dec.begin(), dec.begin() + dec_size, pair.decoded.begin()))
+            return false;
+    }
+    // Truncated final block is malformed
+    const uint8_t bad[] = { 0x03, 0x31 };
+    std::array<uint8_t, 8> sink = {};
+    return cobs_decode({bad, 2}, sink.begin()) == 0;
+}
+
+static constexpr bool run_tap()
+{
+    for (auto& pair : test_pairs) {
+        std::array<uint8_t, 512> enc = {};
+        std::array<uint8_t, 512> dec = {};
+        std::array<uint8_t, 512> seen = {};
+        size_t seen_size = 0;
+        auto tap = [&] (const uint8_t* p, size_t len) {
+            for (size_t i = 0; i < len; ++i)
+                seen[seen_size++] = p[i];
+        };
+        std::span<const uint8_t> in = { pair.decoded.begin(), pair.decoded.size() };
+        // Tapped encode matches the plain overload, tap sees the payload
+        size_t enc_size = cobs_encode(in, std::span<uint8_t>{enc}, tap);
+        if (enc_size != pair.encoded.size() - 1)
+            return false;
+        if (!std::equal(enc.begin(), enc.begin() + enc_size, pair.encoded.begin()))
+            return false;
+        if (seen_size != in.size() || !std::equal(in.begin(), in.end(), seen.begin()))
+            return false;
+        // Tapped decode matches the plain overload, tap sees the payload
+        seen_size = 0;
+        size_t dec_size = cobs_decode({pair.encoded.begin(), pair.encoded.size()}, std::span<uint8_t>{dec}, tap);
+        if (dec_size != pair.decoded.size())
+            return false;
+        if (!std::equal(pair.decoded.begin(), pair.decoded.end(), dec.begin()))
+            return false;
+        if (seen_size != dec_size || !std::equal(pair.decoded.begin(), pair.decoded.end(), seen.begin()))
+            return false;
+        // Truncated output still returns required and taps the full payload
+        seen_size = 0;
+        if (cobs_encode(in, std::span<uint8_t>{enc.data(), 0}, tap) != enc_size)
+            return false;
+        if (seen_size != in.size())
+            return false;
+    }
+    // Truncated final block is malformed
+    const uint8_t bad[] = { 0x05, 0x31 };
+    std::array<uint8_t, 8> sink = {};
+    return cobs_decode({bad, 2}, std::span<uint8_t>{sink}, [] (const uint8_t*, size_t) {}) == 0;
+}
+
+static constexpr bool run_scanner()
+{
+    std::array<uint8_t, 4096> packed = {};
+    std::array<std::span<const uint8_t>, test_pairs.size()> frames = {};
+
+    for (size_t i = 0; i < test_pairs.size(); ++i)
+        frames[i] = { test_pairs[i].decoded.begin(), test_pairs[i].decoded.size() };
+    size_t packed_size = cobs_encode_batch(frames, packed);
+
+    // Feed the packed stream in varying chunk sizes, frames must come out intact
+    for (size_t chunk : { size_t(1), size_t(3), size_t(64), packed_size }) {
+        cobs_frame_scanner_t scanner;
+        size_t idx = 0;
+        bool bad = false;
+        auto cb = [&] (const uint8_t* frame, size_t size) {
+            if (idx == test_pairs.size() ||
+                size != test_pairs[idx].encoded.size() - 1 ||
+                !std::equal(frame, frame + size, test_pairs[idx].encoded.begin()))
+            {
+                bad = true;
+                return;
+            }
+            std::array<uint8_t, 512> dec = {};
+            if (cobs_decode({frame, size}, dec) != test_pairs[idx].decoded.size())
+                bad = true;
+            ++idx;
+        };
+        size_t found = 0;
+        for (size_t off = 0; off < packed_size; off += chunk)
+            found += scanner.sink({packed.data() + off, std::min(chunk, packed_size - off)}, cb);
+        found += scanner.stop(cb);
+        if (bad || idx != test_pairs.size() || found != idx || scanner.dropped())
+            return false;
+    }
+    // A frame outgrowing the buffer is dropped and the scanner resynchronizes
+    cobs_frame_scanner_t<4> tiny;
+    size_t survived = 0;
+    auto count = [&] (const uint8_t*, size_t) { ++survived; };
+    const uint8_t stream[] = { 0x02, 0x31, 0x00, 0x01 };
+    tiny.sink({stream, 2}, count);
+    tiny.sink({stream, 2}, count);    // Straddling frame grows to 4, still fits
+    tiny.sink({stream, 2}, count);    // Grows to 6, dropped
+    tiny.sink({stream + 2, 2}, count); // Delimiter resyncs, then {0x01} buffers
+    if (survived != 0 || tiny.dropped() != 1)
+        return false;
+    return tiny.stop(count) == 1 && survived == 1;
+}
+
+static constexpr bool run_tiled()
+{
+    for (auto& pair : test_pairs) {
+        std::span<const uint8_t> in = { pair.decoded.begin(), pair.decoded.size() };
+        for (size_t tile : { size_t(0), size_t(1), size_t(7), size_t(64), size_t(254) }) {
+            std::array<uint8_t, 512> enc = {};
+            std::array<uint8_t, 512> seen = {};
+            size_t seen_size = 0;
+            size_t tiles = 0;
+            auto cb = [&] (const uint8_t* p, size_t len) {
+                for (size_t i = 0; i < len; ++i)
+                    seen[seen_size++] = p[i];
+                ++tiles;
+            };
+            // Output matches the plain overload, tiles concatenate to it exactly
+            size_t size = cobs_encode_tiled(in, std::span<uint8_t>{enc}, tile, cb);
+            if (size != pair.encoded.size() - 1)
+                return false;
+            if (!std::equal(enc.begin(), enc.begin() + size, pair.encoded.begin()))
+                return false;
+            if (seen_size != size || !std::equal(enc.begin(), enc.begin() + size, seen.begin()))
+                return false;
+            // A single tile for tile_size 0, none for a truncated output
+            if (!tile && tiles != 1)
+                return false;
+            tiles = 0;
+            if (cobs_encode_tiled(in, std::span<uint8_t>{enc.data(), 0}, tile, cb) != size || tiles)
+                return false;
+        }
+    }
+    return true;
+}
+
+static constexpr bool run_flush()
+{
+    std::array<uint8_t, 64> out = {};
+    size_t size = 0;
+    auto cb = [&] (const uint8_t* p, size_t len) {
+        for (size_t i = 0; i < len; ++i)
+            out[size++] = p[i];
+    };
+    cobs_encoder_t encoder;
+    // Empty buffer emits nothing
+    encoder.flush_partial(cb);
+    if (size != 0)
+        return false;
+    // Partial block goes out immediately with a correct code byte
+    const uint8_t first[] = { 0x11, 0x22, 0x33 };
+    encoder.sink(first, cb);
+    encoder.flush_partial(cb);
+    if (size != 4 || out[0] != 0x04)
+        return false;
+    // Frame stays open: more data, then a regular stop
+    const uint8_t second[] = { 0x44, 0x55 };
+    encoder.sink(second, cb);
+    encoder.stop(cb);
+    constexpr uint8_t expected[] = { 0x04, 0x11, 0x22, 0x33, 0x03, 0x44, 0x55, 0x00 };
+    if (size != 8 || !std::equal(out.begin(), out.begin() + 8, expected))
+        return false;
+    // The flush point decodes as one implied zero, a record separator
+    std::array<uint8_t, 16> dec = {};
+    constexpr uint8_t payload[] = { 0x11, 0x22, 0x33, 0x00, 0x44, 0x55 };
+    if (cobs_decode({out.data(), size}, std::span<uint8_t>{dec}) != 6)
+        return false;
+    return std::equal(payload, payload + 6, dec.begin());
+}
+
+static constexpr bool run_alloc()
+{
+    for (auto& pair : test_pairs) {
+        auto frame = cobs_encode_alloc({pair.decoded.begin(), pair.decoded.size()});
+        // Exactly the delimited frame, no worst-case slack
+        if (frame.size() != pair.encoded.size())
+            return false;
+        if (!std::equal(frame.data(), frame.data() + frame.size(), pair.encoded.begin()))
+            return false;
+        std::array<uint8_t, 512> dec = {};
+        if (cobs_decode(frame.span(), std::span<uint8_t>{dec}) != pair.decoded.size())
+            return false;
+    }
+    // Ownership transfers on move, the source releases nothing
+    auto a = cobs_encode_alloc(std::span<const uint8_t>{});
+    auto b = std::move(a);
+    return b.size() == 2 && b.data()[0] == 0x01 && b.data()[1] == 0x00 && a.empty();
+}
+
+static constexpr bool run_frame_decoder()
+{
+    std::array<uint8_t, 4096> packed = {};
+    std::array<std::span<const uint8_t>, test_pairs.size()> frames = {};
+
+    for (size_t i = 0; i < test_pairs.size(); ++i)
+        frames[i] = { test_pairs[i].decoded.begin(), test_pairs[i].decoded.size() };
+    size_t packed_size = cobs_encode_batch(frames, packed);
+
+    // Feed the packed stream in varying chunk sizes, one callback per whole frame
+    for (size_t chunk : { size_t(1), size_t(3), size_t(64), packed_size }) {
+        cobs_frame_decoder_t<512> decoder;
+        size_t idx = 0;
+        bool bad = false;
+        auto cb = [&] (const uint8_t* frame, size_t size, size_t left) {
+            if (left || idx == test_pairs.size() ||
+                size != test_pairs[idx].decoded.size() ||
+                !std::equal(frame, frame + size, test_pairs[idx].decoded.begin()))
+            {
+                bad = true;
+                return;
+            }
+            ++idx;
+        };
+        for (size_t off = 0; off < packed_size; off += chunk)
+            decoder.sink({packed.data() + off, std::min(chunk, packed_size - off)}, cb);
+        if (bad || idx != test_pairs.size() || decoder.dropped())
+            return false;
+    }
+    // A truncated frame reports its missing bytes in left
+    cobs_frame_decoder_t<512> cut;
+    size_t left_seen = 0;
+    const uint8_t bad_frame[] = { 0x05, 0x31, 0x32 };
+    cut.sink({bad_frame, 3}, [&] (const uint8_t*, size_t, size_t left) { left_seen = left; });
+    cut.stop([&] (const uint8_t*, size_t, size_t left) { left_seen = left; });
+    if (left_seen != 2)
+        return false;
+    // A frame outgrowing the buffer is dropped and decoding resynchronizes
+    cobs_frame_decoder_t<4> tiny;
+    size_t survived = 0;
+    auto count = [&] (const uint8_t*, size_t size, size_t left) {
+        if (!left)
+            survived += size;
+    };
+    const uint8_t stream[] = { 0x06, 0x31, 0x32, 0x33, 0x34, 0x35, 0x00, 0x03, 0x41, 0x42, 0x00 };
+    tiny.sink({stream, 11}, count); // 5-byte frame dropped, 2-byte frame delivered
+    return survived == 2 && tiny.dropped() == 1;
+}
+
+static constexpr bool run_iov()
+{
+    for (auto& pair : test_pairs) {
+        size_t n = pair.decoded.size();
+        // Three-way split and one byte per fragment, both must match the contiguous encoding
+        std::array<std::span<const uint8_t>, 300> frags = {};
+        std::array<uint8_t, 512> enc = {};
+        size_t n_frags[] = { std::min<size_t>(3, n ? n : 1), n ? n : 1 };
+
+        for (auto count : n_frags) {
+            size_t off = 0;
+            for (size_t i = 0; i < count; ++i) {
+                size_t len = n / count + (i < n % count);
+                frags[i] = { pair.decoded.begin() + off, len };
+                off += len;
+            }
+            std::span<const std::span<const uint8_t>> iov = { frags.data(), count };
+            size_t size = cobs_encode(iov, enc);
+            if (size != pair.encoded.size() - 1)
+                return false;
+            if (!std::equal(enc.begin(), enc.begin() + size, pair.encoded.begin()))
+                return false;
+            if (cobs_encode(iov, std::span<uint8_t>{enc.data(), 0}) != size)
+                return false;
+            size_t cb_size = 0;
+            std::array<uint8_t, 512> cb_enc = {};
+            size = cobs_encode(iov, [&] (const uint8_t* buf, size_t len) {
+                for (size_t i = 0; i < len; ++i)
+                    cb_enc[cb_size++] = buf[i];
+            });
+            if (size != cb_size || size != pair.encoded.size() - 1)
+                return false;
+            if (!std::equal(cb_enc.begin(), cb_enc.begin() + size, pair.encoded.begin()))
+                return false;
+        }
+    }
+    return true;
+}
+
 #ifdef NTH_COBS_STATIC_ASSERT_TEST
 static_assert(run().status == 0);
+static_assert(run_batch());
+static_assert(run_inplace());
+static_assert(run_block_sizes());
+static_assert(run_sizes());
+static_assert(run_iov());
+static_assert(run_scanner());
+static_assert(run_frame_decoder());
+static_assert(run_alloc());
+static_assert(run_flush());
+static_assert(run_tiled());
+static_assert(run_iterator());
+static_assert(run_tap());
+static_assert(run_static());
+static_assert(run_validate());
+static_assert(run_stats());
+static_assert(run_reduced());
 #endif
 
 }
@@ -238,7 +843,39 @@ int main()
 {
 #ifndef NTH_COBS_STATIC_ASSERT_TEST
     auto test_ret = nth::test::run();
-    if (!test_ret.status) {
+    if (!nth::test::run_batch()) {
+        printf("BATCH TESTS FAILED\n");
+    } else if (!nth::test::run_inplace()) {
+        printf("INPLACE TESTS FAILED\n");
+    } else if (!nth::test::run_block_sizes()) {
+        printf("BLOCK SIZE TESTS FAILED\n");
+    } else if (!nth::test::run_sizes()) {
+        printf("SIZE TESTS FAILED\n");
+    } else if (!nth::test::run_iov()) {
+        printf("IOV TESTS FAILED\n");
+    } else if (!nth::test::run_scanner()) {
+        printf("SCANNER TESTS FAILED\n");
+    } else if (!nth::test::run_alloc()) {
+        printf("ALLOC TESTS FAILED\n");
+    } else if (!nth::test::run_flush()) {
+        printf("FLUSH TESTS FAILED\n");
+    } else if (!nth::test::run_tiled()) {
+        printf("TILED TESTS FAILED\n");
+    } else if (!nth::test::run_frame_decoder()) {
+        printf("FRAME DECODER TESTS FAILED\n");
+    } else if (!nth::test::run_iterator()) {
+        printf("ITERATOR TESTS FAILED\n");
+    } else if (!nth::test::run_tap()) {
+        printf("TAP TESTS FAILED\n");
+    } else if (!nth::test::run_static()) {
+        printf("STATIC TESTS FAILED\n");
+    } else if (!nth::test::run_validate()) {
+        printf("VALIDATE TESTS FAILED\n");
+    } else if (!nth::test::run_stats()) {
+        printf("STATS TESTS FAILED\n");
+    } else if (!nth::test::run_reduced()) {
+        printf("REDUCED TESTS FAILED\n");
+    } else if (!test_ret.status) {
         printf("TESTS PASSED\n");
     } else {
         printf("TESTS FAILED: %lu-%lu-%lu\n", 